@@ -5,6 +5,14 @@
 
 #include <iostream>
 #include <zmq.hpp>
+#include "../common/detection_engine.h"
+#include "../common/detection_stages.h"
+#include "../common/detector_params.h"
+#include "../common/frame_log.h"
+#include "../common/capture_source.h"
+#include "../common/frame_message.h"
+#include "../common/pose_socket.h"
+#include "../common/stats_publisher.h"
 
 using namespace std;
 using namespace cv;
@@ -22,53 +30,31 @@ namespace {
 					"DICT_6X6_50=8, DICT_6X6_100=9, DICT_6X6_250=10, DICT_6X6_1000=11, DICT_7X7_50=12,"
 					"DICT_7X7_100=13, DICT_7X7_250=14, DICT_7X7_1000=15, DICT_ARUCO_ORIGINAL = 16}"
 					"{c        |       | Output file with calibrated camera parameters }"
-					"{v        |       | Input from video file, if ommited, input comes from camera }"
+					"{v        |       | Input from video file, the device or file of the v4l2 and raw backends, if ommited, input comes from camera }"
 					"{ci       | 0     | Camera id if input doesnt come from video (-v) }"
 					"{dp       |       | File of marker detector parameters }"
 					"{rs       |       | Apply refind strategy }"
-					"{r        |       | show rejected candidates too }";
-}
-
-/**
- */
-static bool readCameraParameters(string filename, Mat &camMatrix, Mat &distCoeffs) {
-	FileStorage fs(filename, FileStorage::READ);
-	if(!fs.isOpened())
-		return false;
-	fs["camera_matrix"] >> camMatrix;
-	fs["distortion_coefficients"] >> distCoeffs;
-	return true;
-}
-
-
-
-/**
- */
-static bool readDetectorParameters(string filename, Ptr<aruco::DetectorParameters> &params) {
-	FileStorage fs(filename, FileStorage::READ);
-	if(!fs.isOpened())
-		return false;
-	fs["adaptiveThreshWinSizeMin"] >> params->adaptiveThreshWinSizeMin;
-	fs["adaptiveThreshWinSizeMax"] >> params->adaptiveThreshWinSizeMax;
-	fs["adaptiveThreshWinSizeStep"] >> params->adaptiveThreshWinSizeStep;
-	fs["adaptiveThreshConstant"] >> params->adaptiveThreshConstant;
-	fs["minMarkerPerimeterRate"] >> params->minMarkerPerimeterRate;
-	fs["maxMarkerPerimeterRate"] >> params->maxMarkerPerimeterRate;
-	fs["polygonalApproxAccuracyRate"] >> params->polygonalApproxAccuracyRate;
-	fs["minCornerDistanceRate"] >> params->minCornerDistanceRate;
-	fs["minDistanceToBorder"] >> params->minDistanceToBorder;
-	fs["minMarkerDistanceRate"] >> params->minMarkerDistanceRate;
-	fs["cornerRefinementMethod"] >> params->cornerRefinementMethod;
-	fs["cornerRefinementWinSize"] >> params->cornerRefinementWinSize;
-	fs["cornerRefinementMaxIterations"] >> params->cornerRefinementMaxIterations;
-	fs["cornerRefinementMinAccuracy"] >> params->cornerRefinementMinAccuracy;
-	fs["markerBorderBits"] >> params->markerBorderBits;
-	fs["perspectiveRemovePixelPerCell"] >> params->perspectiveRemovePixelPerCell;
-	fs["perspectiveRemoveIgnoredMarginPerCell"] >> params->perspectiveRemoveIgnoredMarginPerCell;
-	fs["maxErroneousBitsInBorderRate"] >> params->maxErroneousBitsInBorderRate;
-	fs["minOtsuStdDev"] >> params->minOtsuStdDev;
-	fs["errorCorrectionRate"] >> params->errorCorrectionRate;
-	return true;
+					"{r        |       | show rejected candidates too }"
+					"{tr       | 0     | Track markers, scan only around last frame's markers with a full scan every n frames, 0 disables }"
+					"{tp       | 0.5   | Tracking padding around each marker, as a fraction of the marker size }"
+					"{ws       | 0     | Warm start each pose from the previous frame's with at most n Gauss-Newton steps, 0 solves every frame from scratch }"
+					"{ud       | 0     | Undistort corners through a lookup table with a node every n pixels before solving poses, 0 leaves it to the solvers unless the calibration is fisheye }"
+					"{ap       |       | Adapt the perimeter range, threshold windows and pixels per cell to the sizes and contrast of the last frames' markers, widening them again when markers drop out }"
+					"{kf       |       | Filter the poses per id with a constant velocity Kalman filter, keep predicting a lost board and narrow tracking to where they move }"
+					"{hl       |       | Headless, no drawing, no window and no wait between frames }"
+					"{st       |       | Publish stage latency histograms on this ZeroMQ endpoint ex. \"tcp://*:5001\" }"
+					"{sp       | 1000  | Stage latency publishing period in milliseconds }"
+					"{fp       | normal | Pages of the frame buffer pool, normal, thp for transparent huge pages or huge for reserved hugetlbfs pages }"
+					"{cb       | opencv | Capture backend, opencv, v4l2 for the driver's memory mapped buffers raw for a file of raw frames or log for a frame log given with -v }"
+					"{fw       | 640   | Frame width of the v4l2 and raw backends }"
+					"{fh       | 480   | Frame height of the v4l2 and raw backends }"
+					"{pf       | grey  | Pixel format of the v4l2 and raw backends, grey or yuyv }"
+					"{rec      |       | Record every captured frame and its capture stamp to this frame log }"
+					"{rz       |       | Pack the recorded frames losslessly }"
+					"{p        | tcp://0.0.0.0:5000 | Endpoint to send the frames to, or to publish them on }"
+					"{tm       | pair  | Transport, pair connects to one zmqserver, pub and xpub bind the endpoint for any number of subscribers }"
+					"{hwm      | 0     | Messages queued per peer before new ones are dropped or block, 0 keeps ZeroMQ's default }"
+					"{cf       |       | Conflate, every subscriber only gets the newest frame, pub transport only }";
 }
 
 /**
@@ -88,12 +74,15 @@ int main(int argc, const char *const argv[]) {
 	float markerSeparation = parser.get<float>("s");
 	int dictionaryId = parser.get<int>("d");
 	bool showRejected = parser.has("r");
-	bool refindStrategy = parser.has("rs");
+	bool headless = parser.has("hl");
 	int camId = parser.get<int>("ci");
+	int statsPeriod = parser.get<int>("sp");
 
 	Mat camMatrix, distCoeffs;
+	Size calibratedSize;
+	bool fisheye = false;
 	if(parser.has("c")) {
-		bool readOk = readCameraParameters(parser.get<string>("c"), camMatrix, distCoeffs);
+		bool readOk = readCameraParameters(parser.get<string>("c"), camMatrix, distCoeffs, calibratedSize, fisheye);
 		if(!readOk) {
 			cerr << "Invalid camera file" << endl;
 			return 0;
@@ -101,8 +90,9 @@ int main(int argc, const char *const argv[]) {
 	}
 
 	Ptr<aruco::DetectorParameters> detectorParams = aruco::DetectorParameters::create();
+	detector_options detectorOptions;
 	if(parser.has("dp")) {
-		bool readOk = readDetectorParameters(parser.get<string>("dp"), detectorParams);
+		bool readOk = readDetectorParameters(parser.get<string>("dp"), detectorParams, detectorOptions);
 		if(!readOk) {
 			cerr << "Invalid detector parameters file" << endl;
 			return 0;
@@ -115,34 +105,65 @@ int main(int argc, const char *const argv[]) {
 		video = parser.get<String>("v");
 	}
 
+	transport_options transport;
+	transport.endpoint = parser.get<string>("p");
+	if(!parseTransportMode(parser.get<string>("tm"), transport.mode)) {
+		cerr << "Invalid transport, use pair, pub or xpub" << endl;
+		return 0;
+	}
+	transport.highWaterMark = parser.get<int>("hwm");
+	transport.conflate = parser.has("cf");
+	capture_options captureOptions;
+	if(!parseFramePages(parser.get<string>("fp"), captureOptions.pages)) {
+		cerr << "Invalid frame pages, use normal, thp or huge" << endl;
+		return 0;
+	}
+	if(!parseCaptureBackend(parser.get<string>("cb"), captureOptions.backend)) {
+		cerr << "Invalid capture backend, use opencv, v4l2, raw or log" << endl;
+		return 0;
+	}
+	if(!parseCaptureFormat(parser.get<string>("pf"), captureOptions.format)) {
+		cerr << "Invalid pixel format, use grey or yuyv" << endl;
+		return 0;
+	}
+	captureOptions.frameSize = Size(parser.get<int>("fw"), parser.get<int>("fh"));
+	string recordPath = parser.has("rec") ? parser.get<string>("rec") : string();
+	// the frames queued for the recorder hold on to capture buffers too
+	if(!recordPath.empty())
+		captureOptions.bufferCount += frameLogQueueSize;
+
 	if(!parser.check()) {
 		parser.printErrors();
 		return 0;
 	}
 
-    CameraPose pose;
 	Ptr<aruco::Dictionary> dictionary =
 			aruco::getPredefinedDictionary(aruco::PREDEFINED_DICTIONARY_NAME(dictionaryId));
 
-	VideoCapture inputVideo;
-	int waitTime;
-	if(!video.empty()) {
-		inputVideo.open(video);
-		waitTime = 0;
-	} else {
-		inputVideo.open(camId);
-		waitTime = 10;
+	string source = video.empty() ? to_string(camId) : string(video);
+	Ptr<capture_source> input = capture_source::open(source, captureOptions);
+	if(!input)
+		return 0;
+	Ptr<frame_log_writer> recorder;
+	if(!recordPath.empty()) {
+		recorder = makePtr<frame_log_writer>(recordPath, parser.has("rz"));
+		if(!recorder->isOpen())
+			return 0;
 	}
+	int waitTime = video.empty() ? 10 : 0;
+
+	if(!checkTransportOptions(transport))
+		return 0;
 
 	GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-	std::string msg_str;
+
+	// sends the frame messages from pooled buffers, which have to outlive the context
+	frame_publisher publisher;
 
 	//  Prepare our context and socket
 	zmq::context_t context(1);
-	zmq::socket_t socket(context, ZMQ_PAIR);
-	std::cout << "Connecting to server" << std::endl;
-	socket.connect("tcp://0.0.0.0:5000");
+	pose_socket socket(context, transport);
 
 
 	float axisLength = 0.5f * ((float)min(markersX, markersY) * (markerLength + markerSeparation) +
@@ -153,64 +174,79 @@ int main(int argc, const char *const argv[]) {
 			aruco::GridBoard::create(markersX, markersY, markerLength, markerSeparation, dictionary);
 	Ptr<aruco::Board> board = gridboard.staticCast<aruco::Board>();
 
-	double totalTime = 0;
-	int totalIterations = 0;
-
-	while(inputVideo.grab()) {
-		Mat image, imageCopy;
-		inputVideo.retrieve(image);
-
-		double tick = (double)getTickCount();
-
-		vector< int > ids;
-		vector< vector< Point2f > > corners, rejected;
-		Vec3d rvec, tvec;
-
-		// detect markers
-		aruco::detectMarkers(image, dictionary, corners, ids, detectorParams, rejected);
+	engine_options engineOptions;
+	engineOptions.target = TARGET_GRID_BOARD;
+	engineOptions.board = board;
+	engineOptions.refindStrategy = parser.has("rs");
+	engineOptions.collectRejected = showRejected && !headless;
+	engineOptions.trackPeriod = parser.get<int>("tr");
+	engineOptions.trackPadding = parser.get<float>("tp");
+	engineOptions.filterPoses = parser.has("kf");
+	engineOptions.warmIterations = parser.get<int>("ws");
+	engineOptions.undistortCell = parser.get<int>("ud");
+	engineOptions.adaptParams = parser.has("ap");
+
+	detection_engine engine(dictionary, detectorParams, detectorOptions, engineOptions);
+	engine.setCalibration(camMatrix, distCoeffs, calibratedSize, fisheye);
+	const frame_result &result = engine.frameResult();
+
+	stage_latencies latencies;
+	Ptr<stats_publisher> statsPublisher;
+	if(parser.has("st"))
+		statsPublisher = makePtr<stats_publisher>(context, parser.get<string>("st"), statsPeriod, latencies);
+
+	uint32_t frameIndex = 0;
+	uint64_t sequence = 0;
+	capture_stamp stamp;
+
+	// capture retrieves into the source's buffers, drawing reuses its buffer
+	frame_handle frame;
+	Mat imageCopy;
+	for(;;) {
+		{
+			stage_timer timer(&latencies, STAGE_CAPTURE);
+			if(!input->grab())
+				break;
+			stamp = input->stampFrame(++sequence);
+			if(!input->retrieve(frame))
+				break;
+		}
+		if(recorder)
+			recorder->append(frame, stamp);
 
-		// refind strategy to detect more markers
-		if(refindStrategy)
-			aruco::refineDetectedMarkers(image, board, corners, ids, rejected, camMatrix,
-			                             distCoeffs);
+		// detect markers, refind the board's missing ones and estimate the board pose
+		engine.process(frame.mat(), stamp.monotonicUs, &latencies);
 
-		// estimate board pose
-		int markersOfBoardDetected = 0;
-		if(ids.size() > 0)
-			markersOfBoardDetected =
-					aruco::estimatePoseBoard(corners, ids, board, camMatrix, distCoeffs, rvec, tvec);
+		// one message per frame, also when the board was not found
+		fillFrameMessage(engine.setup(), result, ++frameIndex, stamp, publisher.nextMessage());
+		publisher.send(socket.sendSocket(), &latencies);
 
-		double currentTime = ((double)getTickCount() - tick) / getTickFrequency();
-		totalTime += currentTime;
-		totalIterations++;
-		if(totalIterations % 30 == 0) {
-			cout << "Detection Time = " << currentTime * 1000 << " ms "
-			     << "(Mean = " << 1000 * totalTime / double(totalIterations) << " ms)" << endl;
-		}
+		if(headless)
+			continue;
 
 		// draw results
-		image.copyTo(imageCopy);
-		if(ids.size() > 0) {
-			aruco::drawDetectedMarkers(imageCopy, corners, ids);
+		frame.mat().copyTo(imageCopy);
+		if(result.ids.size() > 0) {
+			aruco::drawDetectedMarkers(imageCopy, result.corners, result.ids);
 		}
 
-		if(markersOfBoardDetected > 0) {
-                aruco::drawAxis(imageCopy, camMatrix, distCoeffs, rvec, tvec, axisLength);
-//
-//                msg_str = pose.SerializeAsString();
-//
-//                zmq::message_t request(msg_str.size());
-//
-//
-//                memcpy((void*) request.data(), msg_str.c_str(), msg_str.size());
-//
-//
-//                socket.send(request);
-            }
+		if(showRejected && result.rejected.size() > 0)
+			aruco::drawDetectedMarkers(imageCopy, result.rejected, noArray(), Scalar(100, 0, 255));
+
+		if(result.rvecs.size() > 0)
+			aruco::drawAxis(imageCopy, camMatrix, distCoeffs, result.rvecs[0], result.tvecs[0], axisLength);
+
 		imshow("out", imageCopy);
 		char key = (char)waitKey(waitTime);
 		if(key == 27) break;
 	}
+	cout << "Frame buffers exhausted " << input->exhaustedCount() << " times, " << input->mismatchCount()
+	     << " frames of another size" << endl;
+	if(recorder) {
+		recorder->close();
+		cout << "Recorded " << recorder->writtenCount() << " frames, " << recorder->bytesWritten() << " bytes, "
+		     << recorder->droppedCount() << " frames dropped" << endl;
+	}
 
 	return 0;
 }
\ No newline at end of file
@@ -5,9 +5,23 @@
 #include <vector>
 
 #include <iostream>
+#include <cstdlib>
+#include <sstream>
+#include <thread>
+#include <atomic>
+#include <mutex>
 #include <zmq.hpp>
 #include <google/protobuf/stubs/common.h>
 #include "../gen/pose.pb.h"
+#include "../common/spsc_queue.h"
+#include "../common/capture_source.h"
+#include "../common/detection_engine.h"
+#include "../common/detection_stages.h"
+#include "../common/detector_params.h"
+#include "../common/frame_log.h"
+#include "../common/frame_message.h"
+#include "../common/pose_socket.h"
+#include "../common/stats_publisher.h"
 
 using namespace std;
 using namespace cv;
@@ -20,90 +34,359 @@ namespace {
                     "DICT_4X4_1000=3, DICT_5X5_50=4, DICT_5X5_100=5, DICT_5X5_250=6, DICT_5X5_1000=7, "
                     "DICT_6X6_50=8, DICT_6X6_100=9, DICT_6X6_250=10, DICT_6X6_1000=11, DICT_7X7_50=12,"
                     "DICT_7X7_100=13, DICT_7X7_250=14, DICT_7X7_1000=15, DICT_ARUCO_ORIGINAL = 16}"
-                    "{v        |       | Input from video file, if ommited, input comes from camera }"
+                    "{v        |       | Input from video file, the device or file of the v4l2 and raw backends, if ommited, input comes from camera }"
                     "{ci       | 0     | Camera id if input doesnt come from video (-v) }"
                     "{c        |       | Camera intrinsic parameters. Needed for camera pose }"
                     "{l        | 0.1   | Marker side lenght (in meters). Needed for correct scale in camera pose }"
                     "{dp       |       | File of marker detector parameters }"
                     "{r        |       | show rejected candidates too }"
-                    "{p        |       | full ip to send packetes to ex. \"tcp://0.0.0.0:5000\"}";
+                    "{hl       |       | Headless, no drawing, no window and no wait between frames }"
+                    "{tr       | 0     | Track markers, scan only around last frame's markers with a full scan every n frames, 0 disables }"
+                    "{tp       | 0.5   | Tracking padding around each marker, as a fraction of the marker size }"
+                    "{ws       | 0     | Warm start each pose from the previous frame's with at most n Gauss-Newton steps, 0 solves every frame from scratch }"
+                    "{ud       | 0     | Undistort corners through a lookup table with a node every n pixels before solving poses, 0 leaves it to the solvers unless the calibration is fisheye }"
+                    "{ap       |       | Adapt the perimeter range, threshold windows and pixels per cell to the sizes and contrast of the last frames' markers, widening them again when markers drop out }"
+                    "{sq       |       | Solve marker poses with the closed form square solver instead of estimatePoseSingleMarkers }"
+                    "{kf       |       | Filter the poses per id with a constant velocity Kalman filter, keep predicting lost markers and narrow tracking to where they move }"
+                    "{pl       |       | Pipeline, capture, detection, pose and publishing each run on their own thread }"
+                    "{qs       | 2     | Capacity of each pipeline queue }"
+                    "{qp       | block | Pipeline queue policy, block or drop, either one for all queues or "
+                    "three comma separated for the detect, pose and publish queues }"
+                    "{st       |       | Publish stage latency histograms on this ZeroMQ endpoint ex. \"tcp://*:5001\" }"
+                    "{sp       | 1000  | Stage latency publishing period in milliseconds }"
+                    "{fp       | normal | Pages of the frame buffer pool, normal, thp for transparent huge pages or huge for reserved hugetlbfs pages }"
+                    "{cb       | opencv | Capture backend, opencv, v4l2 for the driver's memory mapped buffers raw for a file of raw frames or log for a frame log given with -v }"
+                    "{fw       | 640   | Frame width of the v4l2 and raw backends }"
+                    "{fh       | 480   | Frame height of the v4l2 and raw backends }"
+                    "{pf       | grey  | Pixel format of the v4l2 and raw backends, grey or yuyv }"
+                    "{rec      |       | Record every captured frame and its capture stamp to this frame log, "
+                    "the -mc cameras each to the file with .<camera id> appended }"
+                    "{rz       |       | Pack the recorded frames losslessly }"
+                    "{p        |       | full ip to send packetes to ex. \"tcp://0.0.0.0:5000\"}"
+                    "{tm       | pair  | Transport, pair connects to one zmqserver, pub and xpub bind the endpoint for any number of subscribers }"
+                    "{hwm      | 0     | Messages queued per peer before new ones are dropped or block, 0 keeps ZeroMQ's default }"
+                    "{cf       |       | Conflate, every subscriber only gets the newest frame, pub transport only }"
+                    "{mc       |       | Several cameras in one process, comma separated camera ids or video files, "
+                    "each detected on its own thread and sent with its position in the list as camera id }"
+                    "{mcc      |       | Camera intrinsic parameters of the -mc cameras, comma separated in the same "
+                    "order, or a single file for all of them. Defaults to -c }";
 }
 
 /**
- * example args
- * -ci=1 -l=.195 -d=11 -dp="/home/paragon/CLionProjects/aruco-detect/aruco_test/charuco_board/detector_params.yml" -c="/home/paragon/CLionProjects/aruco-detect/cameraParameters.yml"
+ * One frame and its results, moved from stage to stage
  */
-static bool readCameraParameters(string filename, Mat &camMatrix, Mat &distCoeffs) {
-    FileStorage fs(filename, FileStorage::READ);
-    if(!fs.isOpened())
-        return false;
-    fs["camera_matrix"] >> camMatrix;
-    fs["distortion_coefficients"] >> distCoeffs;
+struct pipeline_frame {
+    frame_handle image;
+    int index = 0;
+    capture_stamp stamp;
+    frame_result result;
+};
 
-    string s;
-    fs["cameraResolution"] >> s;
-    cout << s << endl;
-    return true;
+/**
+ * Send the markers of the frame, with their poses, quaternions and Euler angles, as one message
+ *
+ * @param frameIndex counts the published frames, unlike the capture sequence it has no gaps
+ */
+static void publishFrame(pose_socket &socket, const detection_setup &setup, frame_publisher &publisher,
+                         const frame_result &result, const capture_stamp &stamp, uint32_t frameIndex,
+                         stage_latencies &latencies) {
+    FrameDetections &message = publisher.nextMessage();
+    fillFrameMessage(setup, result, frameIndex, stamp, message);
+    publisher.send(socket.sendSocket(), &latencies);
 }
 
+/**
+ * Draw markers, rejected candidates and axes onto a copy of the frame
+ */
+static void drawFrame(const detection_setup &setup, const Mat &image, const frame_result &result, float axisLength,
+                      Mat &imageCopy) {
+    image.copyTo(imageCopy);
+    if(result.ids.size() > 0) {
+        aruco::drawDetectedMarkers(imageCopy, result.corners, result.ids);
+    }
 
+    if(result.rejected.size() > 0)
+        aruco::drawDetectedMarkers(imageCopy, result.rejected, noArray(), Scalar(100, 0, 255));
+
+    for(int i = 0; i < result.rvecs.size(); i++) {
+        aruco::drawAxis(imageCopy, setup.camMatrix, setup.distCoeffs, result.rvecs[i], result.tvecs[i], axisLength);
+    }
+}
+
+/**
+ * Split a comma separated option
+ */
+static vector< string > splitList(const string &spec) {
+    vector< string > items;
+    stringstream ss(spec);
+    string item;
+    while(getline(ss, item, ','))
+        items.push_back(item);
+    return items;
+}
 
 /**
+ * Parse the -qp option, a single policy for every queue or one per queue
  */
-static bool readDetectorParameters(string filename, Ptr<aruco::DetectorParameters> &params) {
-    FileStorage fs(filename, FileStorage::READ);
-    if(!fs.isOpened())
+static bool readQueuePolicies(const string &spec, queue_policy policies[3]) {
+    vector< string > names = splitList(spec);
+
+    if(names.size() != 1 && names.size() != 3)
         return false;
-    fs["adaptiveThreshWinSizeMin"] >> params->adaptiveThreshWinSizeMin;
-    fs["adaptiveThreshWinSizeMax"] >> params->adaptiveThreshWinSizeMax;
-    fs["adaptiveThreshWinSizeStep"] >> params->adaptiveThreshWinSizeStep;
-    fs["adaptiveThreshConstant"] >> params->adaptiveThreshConstant;
-    fs["minMarkerPerimeterRate"] >> params->minMarkerPerimeterRate;
-    fs["maxMarkerPerimeterRate"] >> params->maxMarkerPerimeterRate;
-    fs["polygonalApproxAccuracyRate"] >> params->polygonalApproxAccuracyRate;
-    fs["minCornerDistanceRate"] >> params->minCornerDistanceRate;
-    fs["minDistanceToBorder"] >> params->minDistanceToBorder;
-    fs["minMarkerDistanceRate"] >> params->minMarkerDistanceRate;
-    fs["cornerRefinementMethod"] >> params->cornerRefinementMethod;
-    fs["cornerRefinementWinSize"] >> params->cornerRefinementWinSize;
-    fs["cornerRefinementMaxIterations"] >> params->cornerRefinementMaxIterations;
-    fs["cornerRefinementMinAccuracy"] >> params->cornerRefinementMinAccuracy;
-    fs["markerBorderBits"] >> params->markerBorderBits;
-    fs["perspectiveRemovePixelPerCell"] >> params->perspectiveRemovePixelPerCell;
-    fs["perspectiveRemoveIgnoredMarginPerCell"] >> params->perspectiveRemoveIgnoredMarginPerCell;
-    fs["maxErroneousBitsInBorderRate"] >> params->maxErroneousBitsInBorderRate;
-    fs["minOtsuStdDev"] >> params->minOtsuStdDev;
-    fs["errorCorrectionRate"] >> params->errorCorrectionRate;
+    for(int i = 0; i < 3; i++) {
+        if(!parseQueuePolicy(names[names.size() == 1 ? 0 : i], policies[i]))
+            return false;
+    }
     return true;
 }
 
+/**
+ * Hand a finished frame back to the capture thread. The pooled image goes back to its pool now, the
+ * result keeps the capacity of its vectors and Mats for the next frame.
+ */
+static void recycleFrame(spsc_queue< pipeline_frame > &recycled, pipeline_frame &frame) {
+    frame.image.release();
+    frame.result.grey.release();
+    recycled.push(std::move(frame));
+}
 
 /**
- * Convert opencv angles to Yaw Pictch and Roll
- *
- * @param R Input matrix, containing rotation around x y and z in order
- * @return the input matrix converted to Euler angles
+ * Run capture, detection, pose estimation and publishing on their own threads, connected by bounded
+ * queues, so a new frame is captured and detected while the previous one is solved and sent.
+ * The calling thread shows the results unless running headless. Finished frames go back to the
+ * capture thread, so their results are filled again without allocating.
  */
-Vec3d rotationMatrixToEulerAngles(Mat &R) {
-    double sy = sqrt(R.at<double>(0, 0) * R.at<double>(0, 0) + R.at<double>(1, 0) * R.at<double>(1, 0));
+static void runPipeline(capture_source &input, frame_log_writer *recorder, const detection_setup &setup,
+                        pose_socket &socket, frame_publisher &publisher, stage_latencies &latencies, size_t queueSize,
+                        const queue_policy policies[3], bool headless, float axisLength) {
+    spsc_queue< pipeline_frame > detectQueue(queueSize, policies[0]);
+    spsc_queue< pipeline_frame > poseQueue(queueSize, policies[1]);
+    spsc_queue< pipeline_frame > publishQueue(queueSize, policies[2]);
+    // the window takes a frame whenever it has shown the last one, the frames in between go straight back
+    // to capture instead of being dropped here
+    spsc_queue< pipeline_frame > displayQueue(1, QUEUE_DROP_OLDEST);
+    // every frame that can be in flight, in the queues and held by the five threads. One return queue
+    // each for publish and display keeps every queue single producer.
+    size_t inFlight = 3 * queueSize + 1 + 5;
+    spsc_queue< pipeline_frame > publishedFrames(inFlight, QUEUE_DROP_OLDEST);
+    spsc_queue< pipeline_frame > displayedFrames(inFlight, QUEUE_DROP_OLDEST);
+
+    atomic<bool> running(true);
+
+    thread captureThread([&] {
+        int index = 0;
+        pipeline_frame frame;
+        while(running) {
+            // a new frame only while the first frames are in flight, or after a queue dropped one
+            if(!publishedFrames.tryPop(frame) && !displayedFrames.tryPop(frame))
+                frame = pipeline_frame();
+            frame.result.clear();
+            {
+                stage_timer timer(&latencies, STAGE_CAPTURE);
+                if(input.grab()) {
+                    frame.stamp = input.stampFrame((uint64_t)index + 1);
+                    input.retrieve(frame.image);
+                }
+            }
+            if(frame.image.empty())
+                break;
+            if(recorder != nullptr)
+                recorder->append(frame.image, frame.stamp);
+            frame.index = ++index;
+            if(!detectQueue.push(std::move(frame)))
+                break;
+        }
+        detectQueue.close();
+    });
+
+    thread detectThread([&] {
+        pipeline_frame frame;
+        while(detectQueue.pop(frame)) {
+            {
+                stage_timer timer(&latencies, STAGE_CONVERT);
+                convertFrame(frame.image.mat(), frame.result);
+            }
+            {
+                stage_timer timer(&latencies, STAGE_DETECT);
+                detectFrameMarkers(setup, frame.result.grey, frame.result, frame.stamp.monotonicUs);
+            }
+            if(!poseQueue.push(std::move(frame)))
+                break;
+        }
+        poseQueue.close();
+    });
+
+    thread poseThread([&] {
+        pipeline_frame frame;
+        while(poseQueue.pop(frame)) {
+            {
+                stage_timer timer(&latencies, STAGE_POSE);
+                estimateFramePose(setup, frame.result);
+            }
+            if(setup.poseFilter) {
+                stage_timer timer(&latencies, STAGE_FILTER);
+                filterFramePoses(setup, frame.stamp.monotonicUs, frame.result);
+            }
+            if(!publishQueue.push(std::move(frame)))
+                break;
+        }
+        publishQueue.close();
+    });
+
+    thread publishThread([&] {
+        uint32_t published = 0;
+        pipeline_frame frame;
+        while(publishQueue.pop(frame)) {
+            publishFrame(socket, setup, publisher, frame.result, frame.stamp, ++published, latencies);
+
+            // the capture index would skip reports exactly when the queues drop frames
+            if(published % 30 == 0) {
+                cout << "Queue depth detect/pose/publish = " << detectQueue.size() << "/" << poseQueue.size()
+                     << "/" << publishQueue.size() << " (dropped " << detectQueue.droppedCount() << "/"
+                     << poseQueue.droppedCount() << "/" << publishQueue.droppedCount() << "), frame buffers exhausted "
+                     << input.exhaustedCount() << " times" << endl;
+            }
 
-    bool singular = sy < 1e-6;
+            if(!headless && displayQueue.size() == 0)
+                displayQueue.push(std::move(frame));
+            else
+                recycleFrame(publishedFrames, frame);
+        }
+        displayQueue.close();
+    });
+
+    if(!headless) {
+        pipeline_frame frame;
+        Mat imageCopy;
+        while(displayQueue.pop(frame)) {
+            drawFrame(setup, frame.image.mat(), frame.result, axisLength, imageCopy);
+            imshow("out", imageCopy);
+            recycleFrame(displayedFrames, frame);
+            char key = (char)waitKey(1);
+            if(key == 27) break;
+        }
 
-    double x, y, z;
-    if (!singular) {
-        x = atan2(R.at<double>(2, 1), R.at<double>(2, 2));
-        y = atan2(-R.at<double>(2, 0), sy);
-        z = atan2(R.at<double>(1, 0), R.at<double>(0, 0));
-    } else {
-        x = atan2(-R.at<double>(1, 2), R.at<double>(1, 1));
-        y = atan2(-R.at<double>(2, 0), sy);
-        z = 0;
+        // stop capturing, the remaining stages drain and close behind it
+        running = false;
     }
-    return Vec3f(x, y, z);
 
+    captureThread.join();
+    detectThread.join();
+    poseThread.join();
+    displayQueue.close();
+    publishThread.join();
 }
 
 /**
+ * One camera of a multi-camera detector, with its own capture, engine and thread
+ */
+struct camera_worker {
+    Ptr<detection_engine> engine;
+    Ptr<capture_source> capture;
+    Ptr<frame_log_writer> recorder;
+    thread worker;
+    atomic<bool> done;
+
+    std::mutex displayMutex;
+    Mat display;                // newest drawn frame, picked up by the thread showing the windows
+    bool displayUpdated = false;
+
+    camera_worker() : done(false) {}
+};
+
+/**
+ * Detect on every camera at once, each camera on its own thread. The engines share the dictionary and the
+ * detector parameters, the cameras take turns on the one message publisher and socket, and every message
+ * carries the camera's id. The calling thread shows each camera in its own window unless running headless.
+ */
+static void runCameras(vector< Ptr<camera_worker> > &cameras, pose_socket &socket, frame_publisher &publisher,
+                       stage_latencies &latencies, bool headless, float axisLength) {
+    std::mutex sendMutex;
+    atomic<bool> running(true);
+
+    for(size_t c = 0; c < cameras.size(); c++) {
+        camera_worker &camera = *cameras[c];
+        camera.worker = thread([&camera, &socket, &publisher, &latencies, &sendMutex, &running, headless,
+                                       axisLength] {
+            detection_engine &engine = *camera.engine;
+            uint32_t published = 0;
+            frame_handle frame;
+            Mat imageCopy;
+            capture_stamp stamp;
+            while(running) {
+                {
+                    stage_timer timer(&latencies, STAGE_CAPTURE);
+                    if(!camera.capture->grab())
+                        break;
+                    stamp = camera.capture->stampFrame((uint64_t)published + 1);
+                    if(!camera.capture->retrieve(frame))
+                        break;
+                }
+                if(camera.recorder)
+                    camera.recorder->append(frame, stamp);
+
+                engine.process(frame.mat(), stamp.monotonicUs, &latencies);
+
+                {
+                    // serializing and sending take microseconds, a lock is cheaper than a publisher per camera
+                    lock_guard<std::mutex> lock(sendMutex);
+                    publishFrame(socket, engine.setup(), publisher, engine.frameResult(), stamp, ++published,
+                                 latencies);
+                }
+
+                if(!headless) {
+                    drawFrame(engine.setup(), frame.mat(), engine.frameResult(), axisLength, imageCopy);
+                    lock_guard<std::mutex> lock(camera.displayMutex);
+                    std::swap(camera.display, imageCopy);
+                    camera.displayUpdated = true;
+                }
+            }
+            camera.done = true;
+        });
+    }
+
+    if(!headless) {
+        Mat image;
+        for(;;) {
+            bool allDone = true;
+            for(size_t c = 0; c < cameras.size(); c++) {
+                camera_worker &camera = *cameras[c];
+                allDone = allDone && camera.done;
+                {
+                    lock_guard<std::mutex> lock(camera.displayMutex);
+                    if(!camera.displayUpdated)
+                        continue;
+                    std::swap(image, camera.display);
+                    camera.displayUpdated = false;
+                }
+                imshow("out " + to_string(c), image);
+            }
+            if(allDone)
+                break;
+            char key = (char)waitKey(1);
+            if(key == 27) break;
+        }
+        running = false;
+    }
+
+    for(size_t c = 0; c < cameras.size(); c++)
+        cameras[c]->worker.join();
+}
+
+/**
+ * Finish a recording and tell how much of it made it to the log
+ */
+static void reportRecording(const Ptr<frame_log_writer> &recorder) {
+    if(!recorder)
+        return;
+    recorder->close();
+    cout << "Recorded " << recorder->writtenCount() << " frames, " << recorder->bytesWritten() << " bytes, "
+         << recorder->droppedCount() << " frames dropped" << endl;
+}
+
+/**
+ * example args
+ * -ci=1 -l=.195 -d=11 -dp="/home/paragon/CLionProjects/aruco-detect/aruco_test/charuco_board/detector_params.yml" -c="/home/paragon/CLionProjects/aruco-detect/cameraParameters.yml"
  */
 int main(int argc, const char *const argv[]) {
     CommandLineParser parser(argc, argv, keys);
@@ -116,16 +399,18 @@ int main(int argc, const char *const argv[]) {
 
     int dictionaryId = parser.get<int>("d");
     bool showRejected = parser.has("r");
-    bool estimatePose = parser.has("c");
+    bool headless = parser.has("hl");
     float markerLength = parser.get<float>("l");
 
 
     int camId = parser.get<int>("ci");
 
     Mat camMatrix, distCoeffs;
+    Size calibratedSize;
+    bool fisheye = false;
 
     if(parser.has("c")) {
-        bool readOk = readCameraParameters(parser.get<string>("c"), camMatrix, distCoeffs);
+        bool readOk = readCameraParameters(parser.get<string>("c"), camMatrix, distCoeffs, calibratedSize, fisheye);
         if(!readOk) {
             cerr << "Invalid camera file" << endl;
             return 0;
@@ -133,140 +418,211 @@ int main(int argc, const char *const argv[]) {
     }
 
     Ptr<aruco::DetectorParameters> detectorParams = aruco::DetectorParameters::create();
+    detector_options detectorOptions;
     if(parser.has("dp")) {
-        bool readOk = readDetectorParameters(parser.get<string>("dp"), detectorParams);
+        bool readOk = readDetectorParameters(parser.get<string>("dp"), detectorParams, detectorOptions);
         if(!readOk) {
             cerr << "Invalid detector parameters file" << endl;
             return 0;
         }
     }
     detectorParams->cornerRefinementMethod = aruco::CORNER_REFINE_SUBPIX; // do corner refinement in markers
-    int video;
-    if(parser.has("v")) {
-        video = parser.get<int>("v");
-    }
+    string video = parser.has("v") ? parser.get<string>("v") : to_string(camId);
 
 
-    String port;
+    transport_options transport;
     if(parser.has("p")) {
-        port = parser.get<String>("p");
+        transport.endpoint = parser.get<String>("p");
     } else {
         cerr << "No ip given" << endl;
         return 0;
     }
-
-    if(!parser.check()) {
-        parser.printErrors();
+    if(!parseTransportMode(parser.get<string>("tm"), transport.mode)) {
+        cerr << "Invalid transport, use pair, pub or xpub" << endl;
         return 0;
     }
+    transport.highWaterMark = parser.get<int>("hwm");
+    transport.conflate = parser.has("cf");
+    if(!checkTransportOptions(transport))
+        return 0;
 
-    //Pose object {x y z pitch roll yaw}
-    CameraPose pose;
+    engine_options engineOptions;
+    engineOptions.target = TARGET_MARKERS;
+    engineOptions.markerLength = markerLength;
+    engineOptions.collectRejected = showRejected && !headless;
+    engineOptions.trackPeriod = parser.get<int>("tr");
+    engineOptions.trackPadding = parser.get<float>("tp");
+    engineOptions.filterPoses = parser.has("kf");
+    engineOptions.warmIterations = parser.get<int>("ws");
+    engineOptions.squareSolver = parser.has("sq");
+    engineOptions.undistortCell = parser.get<int>("ud");
+    engineOptions.adaptParams = parser.has("ap");
+    int statsPeriod = parser.get<int>("sp");
+    capture_options captureOptions;
+    if(!parseFramePages(parser.get<string>("fp"), captureOptions.pages)) {
+        cerr << "Invalid frame pages, use normal, thp or huge" << endl;
+        return 0;
+    }
+    if(!parseCaptureBackend(parser.get<string>("cb"), captureOptions.backend)) {
+        cerr << "Invalid capture backend, use opencv, v4l2, raw or log" << endl;
+        return 0;
+    }
+    if(!parseCaptureFormat(parser.get<string>("pf"), captureOptions.format)) {
+        cerr << "Invalid pixel format, use grey or yuyv" << endl;
+        return 0;
+    }
+    captureOptions.frameSize = Size(parser.get<int>("fw"), parser.get<int>("fh"));
+    string recordPath = parser.has("rec") ? parser.get<string>("rec") : string();
+    bool recordPacked = parser.has("rz");
+    // the frames queued for the recorder hold on to capture buffers too
+    size_t recordBuffers = recordPath.empty() ? 0 : frameLogQueueSize;
+    captureOptions.bufferCount += recordBuffers;
+
+    bool usePipeline = parser.has("pl");
+    size_t queueSize = (size_t)max(1, parser.get<int>("qs"));
+    queue_policy queuePolicies[3];
+    if(!readQueuePolicies(parser.get<string>("qp"), queuePolicies)) {
+        cerr << "Invalid queue policy, use block or drop" << endl;
+        return 0;
+    }
 
-    //Angles calculated, {x y z}
-    Mat rotationAngles;
+    vector< string > cameraSources, cameraFiles;
+    if(parser.has("mc"))
+        cameraSources = splitList(parser.get<string>("mc"));
+    if(parser.has("mcc"))
+        cameraFiles = splitList(parser.get<string>("mcc"));
+    if(!cameraFiles.empty() && cameraFiles.size() != 1 && cameraFiles.size() != cameraSources.size()) {
+        cerr << "Give one camera file per camera, or one for all of them" << endl;
+        return 0;
+    }
+    if(!cameraSources.empty() && usePipeline) {
+        cerr << "The pipeline runs a single camera, every camera already has its own thread" << endl;
+        return 0;
+    }
 
-    //Angles we send, {pitch, roll, yaw}
-    Vec3d taitBryanAngles;
+    if(!parser.check()) {
+        parser.printErrors();
+        return 0;
+    }
 
     Ptr<aruco::Dictionary> dictionary =
             aruco::getPredefinedDictionary(aruco::PREDEFINED_DICTIONARY_NAME(dictionaryId));
 
-    //Open a video input, if no user input exists, use default camera
-    VideoCapture inputVideo;
-    try {
-        inputVideo.open(video);
-    }catch(const exception& e){
-        inputVideo.open(0);
+    //One engine per camera, they share the dictionary and detector parameters
+    vector< Ptr<camera_worker> > cameras;
+    for(size_t c = 0; c < cameraSources.size(); c++) {
+        Ptr<camera_worker> camera = makePtr<camera_worker>();
+        camera->engine = makePtr<detection_engine>(dictionary, detectorParams, detectorOptions, engineOptions);
+        camera->engine->setCameraId((int)c);
+        if(cameraFiles.empty()) {
+            camera->engine->setCalibration(camMatrix, distCoeffs, calibratedSize, fisheye);
+        } else {
+            const string &file = cameraFiles[cameraFiles.size() == 1 ? 0 : c];
+            if(!camera->engine->readCalibration(file)) {
+                cerr << "Invalid camera file " << file << endl;
+                return 0;
+            }
+        }
+
+        camera->capture = capture_source::open(cameraSources[c], captureOptions);
+        if(!camera->capture)
+            return 0;
+        if(!recordPath.empty()) {
+            camera->recorder = makePtr<frame_log_writer>(recordPath + "." + to_string(c), recordPacked);
+            if(!camera->recorder->isOpen())
+                return 0;
+        }
+        cameras.push_back(camera);
+    }
+
+    //Open a video input, if no user input exists, use the camera, and the engine that detects on it
+    Ptr<capture_source> input;
+    Ptr<detection_engine> engine;
+    if(cameras.empty()) {
+        engine = makePtr<detection_engine>(dictionary, detectorParams, detectorOptions, engineOptions);
+        engine->setCalibration(camMatrix, distCoeffs, calibratedSize, fisheye);
+        // every queue full, plus the frame each of the five pipeline threads holds
+        captureOptions.bufferCount = (usePipeline ? 3 * queueSize + 1 + 5 : 4) + recordBuffers;
+        input = capture_source::open(video, captureOptions);
+        if(!input)
+            return 0;
+    }
+    Ptr<frame_log_writer> recorder;
+    if(cameras.empty() && !recordPath.empty()) {
+        recorder = makePtr<frame_log_writer>(recordPath, recordPacked);
+        if(!recorder->isOpen())
+            return 0;
     }
     int waitTime=10;
 
     GOOGLE_PROTOBUF_VERIFY_VERSION;
-    std::string msg_str;
+
+    //Detections of a frame, {id x y z rotation pitch roll yaw corners}, sent from pooled buffers that have
+    //to outlive the context
+    frame_publisher publisher;
 
     //  Prepare our context and socket
     zmq::context_t context(1);
-    zmq::socket_t socket(context, ZMQ_PAIR);
-    std::cout << "Connecting to server" << std::endl;
-
-    socket.connect(port);
+    pose_socket socket(context, transport);
 
     float axisLength = 0.5f * markerLength;
 
+    stage_latencies latencies;
+    Ptr<stats_publisher> statsPublisher;
+    if(parser.has("st"))
+        statsPublisher = makePtr<stats_publisher>(context, parser.get<string>("st"), statsPeriod, latencies);
 
-    double totalTime = 0;
-
-    int totalIterations = 0;
-
-    while(inputVideo.grab()) {
-        Mat image, imageCopy;
-        inputVideo.retrieve(image);
-
-        double tick = (double)getTickCount();
-
-        vector< int > ids;
-        vector< vector< Point2f > > corners, rejected;
-        vector<Vec3d> rvecs, tvecs;
-
-        // detect markers
-        aruco::detectMarkers(image, dictionary, corners, ids, detectorParams, rejected);
+    if(!cameras.empty()) {
+        runCameras(cameras, socket, publisher, latencies, headless, axisLength);
+        for(size_t c = 0; c < cameras.size(); c++)
+            reportRecording(cameras[c]->recorder);
+        return 0;
+    }
 
-        // estimate board pose
-        int markersOfBoardDetected = 0;
-        if(ids.size() > 0)
-                    aruco::estimatePoseSingleMarkers(corners, markerLength,camMatrix, distCoeffs, rvecs, tvecs);
+    if(usePipeline) {
+        runPipeline(*input, recorder.get(), engine->setup(), socket, publisher, latencies, queueSize, queuePolicies,
+                    headless, axisLength);
+        reportRecording(recorder);
+        return 0;
+    }
 
-        double currentTime = ((double)getTickCount() - tick) / getTickFrequency();
-        totalTime += currentTime;
-        totalIterations++;
 
-        // draw results
-        image.copyTo(imageCopy);
-        if(ids.size() > 0) {
-            aruco::drawDetectedMarkers(imageCopy, corners, ids);
-        }
+    int totalIterations = 0;
 
-        for(int i = 0; i < ids.size(); i++) {
-            aruco::drawAxis(imageCopy, camMatrix, distCoeffs, rvecs[i], tvecs[i], axisLength);
+    //Capture retrieves into the source's buffers, drawing reuses its buffer
+    frame_handle frame;
+    Mat imageCopy;
+    capture_stamp stamp;
+    for(;;) {
+        {
+            stage_timer timer(&latencies, STAGE_CAPTURE);
+            if(!input->grab())
+                break;
+            stamp = input->stampFrame((uint64_t)totalIterations + 1);
+            if(!input->retrieve(frame))
+                break;
         }
+        if(recorder)
+            recorder->append(frame, stamp);
 
-        if(totalIterations % 30 == 0){
-            for(int i = 0; i < ids.size(); i++) {
-                cout << "Position vectors: " << tvecs[i][0] << " " << tvecs[i][1] << " " << tvecs[i][2] <<endl;
+        engine->process(frame.mat(), stamp.monotonicUs, &latencies);
 
-                pose.set_x(tvecs[i][0]);
-                pose.set_y(tvecs[i][1]);
-                pose.set_z(tvecs[i][2]);
-
-
-                rotationAngles = Mat(rvecs[i], true);
-
-                taitBryanAngles = rotationMatrixToEulerAngles(rotationAngles);
-
-//                cout << "Rotation vectors: " << taitBryanAngles[0] << " " << taitBryanAngles[1] << " " << taitBryanAngles[2] << endl;
-
-                pose.set_yaw(taitBryanAngles[0]);
-                pose.set_pitch(taitBryanAngles[1]);
-                pose.set_roll(taitBryanAngles[2]);
-
-
-                msg_str = pose.SerializeAsString();
-
-                zmq::message_t request(msg_str.size());
-
-                memcpy((void*) request.data(), msg_str.c_str(), msg_str.size());
-
-
-                socket.send(request);
+        totalIterations++;
 
-            }
+        // send before drawing, the drawing would only add to the latency of the message
+        publishFrame(socket, engine->setup(), publisher, engine->frameResult(), stamp, (uint32_t)totalIterations,
+                     latencies);
 
+        if(!headless) {
+            drawFrame(engine->setup(), frame.mat(), engine->frameResult(), axisLength, imageCopy);
+            imshow("out", imageCopy);
+            char key = (char)waitKey(waitTime);
+            if(key == 27) break;
         }
-
-        imshow("out", imageCopy);
-        char key = (char)waitKey(waitTime);
-        if(key == 27) break;
     }
+    cout << "Frame buffers exhausted " << input->exhaustedCount() << " times, " << input->mismatchCount()
+         << " frames of another size" << endl;
+    reportRecording(recorder);
 
     //Generate board
 //        Ptr<aruco::CharucoBoard> board = aruco::CharucoBoard::create(3, 6, .15, .13,
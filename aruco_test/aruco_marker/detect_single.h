@@ -1,14 +0,0 @@
-//
-// Created by paragon on 3/1/18.
-//
-
-#ifndef ARUCO_TEST_DETECT_SINGLE_H
-#define ARUCO_TEST_DETECT_SINGLE_H
-
-
-class detect_single {
-
-};
-
-
-#endif //ARUCO_TEST_DETECT_SINGLE_H
@@ -0,0 +1,600 @@
+#include <opencv2/aruco.hpp>
+#include <sys/stat.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "../common/detection_engine.h"
+#include "../common/detection_stages.h"
+#include "../common/detector_params.h"
+#include "../common/replay_source.h"
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    const char* about = "Search the detector parameters for the fastest ones that still find what a reference "
+                        "detection set holds, and write them as a detector parameter file";
+    const char* keys  =
+            "{v        |       | Video file, directory of images or frame log to tune on }"
+                    "{d        |       | dictionary: DICT_4X4_50=0, DICT_4X4_100=1, DICT_4X4_250=2,"
+                    "DICT_4X4_1000=3, DICT_5X5_50=4, DICT_5X5_100=5, DICT_5X5_250=6, DICT_5X5_1000=7, "
+                    "DICT_6X6_50=8, DICT_6X6_100=9, DICT_6X6_250=10, DICT_6X6_1000=11, DICT_7X7_50=12,"
+                    "DICT_7X7_100=13, DICT_7X7_250=14, DICT_7X7_1000=15, DICT_ARUCO_ORIGINAL = 16}"
+                    "{dp       |       | Detector parameter file to start the search from }"
+                    "{ref      |       | Reference detections, written by detecting with the -dp parameters when the file does not exist yet }"
+                    "{o        | tuned_params.yml | Detector parameter file to write }"
+                    "{rc       | 0.99  | Recall to keep, the fraction of the reference markers found }"
+                    "{ce       | 0.5   | Corner accuracy to keep, RMS pixel distance to the reference corners }"
+                    "{n        | 0     | Tune on the first n frames only, 0 takes all }"
+                    "{j        | 0     | Parameter sets detected at once, 0 for one per core. With more than one, OpenCV's own threads are turned off }"
+                    "{rep      | 2     | Detect every frame this many times per parameter set and keep the fastest run }"
+                    "{mg       | 0.02  | Smallest relative speed up a change has to bring, below it timing noise could have made it }"
+                    "{pa       | 4     | Most passes over the parameters }";
+
+    // markers further than this from their reference, on average over the corners, were not found
+    const double matchDistance = 10.0;
+
+    /**
+     * The parameters searched, each over a fixed set of values. Every other parameter keeps the value of
+     * the starting file.
+     */
+    enum tuned_parameter {
+        TUNE_WIN_SIZE_MIN,
+        TUNE_WIN_SIZE_MAX,
+        TUNE_WIN_SIZE_STEP,
+        TUNE_THRESH_CONSTANT,
+        TUNE_MIN_PERIMETER,
+        TUNE_MAX_PERIMETER,
+        TUNE_POLYGON_ACCURACY,
+        TUNE_PIXEL_PER_CELL,
+        TUNE_IGNORED_MARGIN,
+        TUNE_REFINEMENT_WIN_SIZE,
+        TUNE_REFINEMENT_ITERATIONS,
+        TUNE_DECIMATION,
+        TUNE_INTEGRAL_THRESHOLD,
+        TUNE_PARAMETER_COUNT
+    };
+
+    const char *parameterNames[TUNE_PARAMETER_COUNT] = {
+            "adaptiveThreshWinSizeMin", "adaptiveThreshWinSizeMax", "adaptiveThreshWinSizeStep",
+            "adaptiveThreshConstant", "minMarkerPerimeterRate", "maxMarkerPerimeterRate",
+            "polygonalApproxAccuracyRate", "perspectiveRemovePixelPerCell", "perspectiveRemoveIgnoredMarginPerCell",
+            "cornerRefinementWinSize", "cornerRefinementMaxIterations", "decimation", "integralThreshold"
+    };
+
+    vector< double > parameterValues(tuned_parameter parameter) {
+        switch(parameter) {
+            case TUNE_WIN_SIZE_MIN: return {3, 5, 7, 9, 13, 17, 23};
+            case TUNE_WIN_SIZE_MAX: return {7, 9, 13, 17, 23, 33, 43, 53};
+            case TUNE_WIN_SIZE_STEP: return {2, 4, 6, 10, 14, 20, 30, 50};
+            case TUNE_THRESH_CONSTANT: return {3, 5, 7, 9, 11};
+            case TUNE_MIN_PERIMETER: return {0.01, 0.02, 0.03, 0.05, 0.08, 0.12, 0.2};
+            case TUNE_MAX_PERIMETER: return {1, 2, 4};
+            case TUNE_POLYGON_ACCURACY: return {0.02, 0.03, 0.05, 0.08, 0.1};
+            case TUNE_PIXEL_PER_CELL: return {2, 3, 4, 6, 8};
+            case TUNE_IGNORED_MARGIN: return {0.1, 0.13, 0.2, 0.3};
+            case TUNE_REFINEMENT_WIN_SIZE: return {3, 5, 7};
+            case TUNE_REFINEMENT_ITERATIONS: return {5, 10, 30};
+            case TUNE_DECIMATION: return {1, 2, 4};
+            case TUNE_INTEGRAL_THRESHOLD: return {0, 1};
+            default: return {};
+        }
+    }
+
+    /**
+     * Everything readDetectorParameters fills, the unit the search changes one parameter of at a time
+     */
+    struct tuner_config {
+        aruco::DetectorParameters params;
+        detector_options options;
+    };
+
+    double getParameter(const tuner_config &config, tuned_parameter parameter) {
+        const aruco::DetectorParameters &p = config.params;
+        switch(parameter) {
+            case TUNE_WIN_SIZE_MIN: return p.adaptiveThreshWinSizeMin;
+            case TUNE_WIN_SIZE_MAX: return p.adaptiveThreshWinSizeMax;
+            case TUNE_WIN_SIZE_STEP: return p.adaptiveThreshWinSizeStep;
+            case TUNE_THRESH_CONSTANT: return p.adaptiveThreshConstant;
+            case TUNE_MIN_PERIMETER: return p.minMarkerPerimeterRate;
+            case TUNE_MAX_PERIMETER: return p.maxMarkerPerimeterRate;
+            case TUNE_POLYGON_ACCURACY: return p.polygonalApproxAccuracyRate;
+            case TUNE_PIXEL_PER_CELL: return p.perspectiveRemovePixelPerCell;
+            case TUNE_IGNORED_MARGIN: return p.perspectiveRemoveIgnoredMarginPerCell;
+            case TUNE_REFINEMENT_WIN_SIZE: return p.cornerRefinementWinSize;
+            case TUNE_REFINEMENT_ITERATIONS: return p.cornerRefinementMaxIterations;
+            case TUNE_DECIMATION: return config.options.decimation;
+            case TUNE_INTEGRAL_THRESHOLD: return config.options.integralThreshold ? 1 : 0;
+            default: return 0;
+        }
+    }
+
+    void setParameter(tuner_config &config, tuned_parameter parameter, double value) {
+        aruco::DetectorParameters &p = config.params;
+        switch(parameter) {
+            case TUNE_WIN_SIZE_MIN: p.adaptiveThreshWinSizeMin = (int)value; break;
+            case TUNE_WIN_SIZE_MAX: p.adaptiveThreshWinSizeMax = (int)value; break;
+            case TUNE_WIN_SIZE_STEP: p.adaptiveThreshWinSizeStep = (int)value; break;
+            case TUNE_THRESH_CONSTANT: p.adaptiveThreshConstant = value; break;
+            case TUNE_MIN_PERIMETER: p.minMarkerPerimeterRate = value; break;
+            case TUNE_MAX_PERIMETER: p.maxMarkerPerimeterRate = value; break;
+            case TUNE_POLYGON_ACCURACY: p.polygonalApproxAccuracyRate = value; break;
+            case TUNE_PIXEL_PER_CELL: p.perspectiveRemovePixelPerCell = (int)value; break;
+            case TUNE_IGNORED_MARGIN: p.perspectiveRemoveIgnoredMarginPerCell = value; break;
+            case TUNE_REFINEMENT_WIN_SIZE: p.cornerRefinementWinSize = (int)value; break;
+            case TUNE_REFINEMENT_ITERATIONS: p.cornerRefinementMaxIterations = (int)value; break;
+            case TUNE_DECIMATION: config.options.decimation = (int)value; break;
+            case TUNE_INTEGRAL_THRESHOLD: config.options.integralThreshold = value != 0; break;
+            default: break;
+        }
+    }
+
+    /** Combinations aruco rejects or that can not detect anything */
+    bool validConfig(const tuner_config &config) {
+        const aruco::DetectorParameters &p = config.params;
+        int decimation = config.options.decimation;
+        return p.adaptiveThreshWinSizeMin >= 3 && p.adaptiveThreshWinSizeMax >= p.adaptiveThreshWinSizeMin &&
+               p.adaptiveThreshWinSizeStep > 0 && p.minMarkerPerimeterRate < p.maxMarkerPerimeterRate &&
+               (decimation == 1 || decimation == 2 || decimation == 4);
+    }
+
+    /**
+     * The markers of one reference frame, four corners per id
+     */
+    struct frame_reference {
+        vector< int > ids;
+        vector< float > corners;    // x0, y0, x1, y1, ... in the order of ids
+    };
+
+    /**
+     * @return false if the file can not be read or parsed, or a frame has other than four corners per id
+     */
+    bool readReference(const string &filename, vector< frame_reference > &reference) {
+        try {
+            FileStorage fs(filename, FileStorage::READ);
+            if(!fs.isOpened())
+                return false;
+            FileNode frames = fs["frames"];
+            reference.clear();
+            for(FileNodeIterator it = frames.begin(); it != frames.end(); ++it) {
+                frame_reference frame;
+                (*it)["ids"] >> frame.ids;
+                (*it)["corners"] >> frame.corners;
+                if(frame.corners.size() != 8 * frame.ids.size()) {
+                    cerr << filename << " frame " << reference.size() << " has " << frame.corners.size()
+                         << " corner coordinates for " << frame.ids.size() << " ids" << endl;
+                    return false;
+                }
+                reference.push_back(frame);
+            }
+        } catch(const cv::Exception &e) {
+            // FileStorage throws on malformed YAML
+            cerr << e.what() << endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool writeReference(const string &filename, const vector< frame_reference > &reference) {
+        FileStorage fs(filename, FileStorage::WRITE);
+        if(!fs.isOpened())
+            return false;
+        fs << "frames" << "[";
+        for(size_t i = 0; i < reference.size(); i++)
+            fs << "{" << "ids" << reference[i].ids << "corners" << reference[i].corners << "}";
+        fs << "]";
+        return true;
+    }
+
+    /**
+     * How one parameter set did on the footage
+     */
+    struct evaluation {
+        double msPerFrame = 0;
+        double recall = 0;          // reference markers found
+        double cornerError = 0;     // RMS corner distance of the found markers in pixels
+        long extraMarkers = 0;      // detections the reference does not have
+        bool valid = false;
+    };
+
+    bool feasible(const evaluation &e, double minRecall, double maxCornerError) {
+        return e.valid && e.recall >= minRecall && e.cornerError <= maxCornerError;
+    }
+
+    /**
+     * Feasible sets beat infeasible ones, then the faster feasible set or the one closer to the recall wins
+     */
+    bool better(const evaluation &a, const evaluation &b, double minRecall, double maxCornerError) {
+        bool aFeasible = feasible(a, minRecall, maxCornerError);
+        bool bFeasible = feasible(b, minRecall, maxCornerError);
+        if(aFeasible != bFeasible)
+            return aFeasible;
+        if(!aFeasible)
+            return a.valid && (!b.valid || a.recall > b.recall);
+        return a.msPerFrame < b.msPerFrame;
+    }
+
+    /**
+     * The frames, their reference and what every detection needs besides the parameters
+     */
+    struct tuning_data {
+        Ptr<aruco::Dictionary> dictionary;
+        vector< Mat > frames;           // grey, converted once up front
+        vector< frame_reference > reference;
+        int repetitions = 1;
+    };
+
+    /**
+     * Score the detections of one frame against its reference
+     */
+    void scoreFrame(const engine_results &results, const frame_reference &reference, long &found,
+                    double &squaredError, long &extra) {
+        vector< bool > used(results.markerCount(), false);
+        for(size_t r = 0; r < reference.ids.size(); r++) {
+            const float *expected = &reference.corners[8 * r];
+            double bestDistance = matchDistance;
+            double bestSquared = 0;
+            size_t best = results.markerCount();
+            for(size_t i = 0; i < results.markerCount(); i++) {
+                if(used[i] || results.ids[i] != reference.ids[r])
+                    continue;
+                const Point2f *corners = results.markerCorners(i);
+                double distance = 0, squared = 0;
+                for(int c = 0; c < 4; c++) {
+                    double dx = corners[c].x - expected[2 * c], dy = corners[c].y - expected[2 * c + 1];
+                    squared += dx * dx + dy * dy;
+                    distance += sqrt(dx * dx + dy * dy) / 4;
+                }
+                if(distance < bestDistance) {
+                    bestDistance = distance;
+                    bestSquared = squared;
+                    best = i;
+                }
+            }
+            if(best == results.markerCount())
+                continue;
+            used[best] = true;
+            found++;
+            squaredError += bestSquared;
+        }
+        for(size_t i = 0; i < used.size(); i++)
+            extra += used[i] ? 0 : 1;
+    }
+
+    evaluation evaluate(const tuning_data &data, const tuner_config &config) {
+        evaluation result;
+        if(!validConfig(config))
+            return result;
+
+        engine_options engineOptions;
+        engineOptions.target = TARGET_MARKERS;
+        detection_engine engine(data.dictionary, makePtr<aruco::DetectorParameters>(config.params), config.options,
+                                engineOptions);
+
+        long expected = 0, found = 0, extra = 0;
+        double squaredError = 0;
+        double fastest = 0;
+        for(int run = 0; run < data.repetitions; run++) {
+            bool score = run == 0;
+            int64 ticks = 0;
+            for(size_t f = 0; f < data.frames.size(); f++) {
+                // only the detection is timed, the first run scores each frame outside of that
+                int64 start = getTickCount();
+                engine.process(data.frames[f]);
+                ticks += getTickCount() - start;
+                if(score) {
+                    expected += (long)data.reference[f].ids.size();
+                    scoreFrame(engine.results(), data.reference[f], found, squaredError, extra);
+                }
+            }
+            double ms = (double)ticks * 1000.0 / getTickFrequency();
+            if(run == 0 || ms < fastest)
+                fastest = ms;
+        }
+
+        result.valid = true;
+        result.msPerFrame = data.frames.empty() ? 0 : fastest / data.frames.size();
+        result.recall = expected > 0 ? (double)found / expected : 1;
+        result.cornerError = found > 0 ? sqrt(squaredError / (4 * found)) : 0;
+        result.extraMarkers = extra;
+        return result;
+    }
+
+    /**
+     * Evaluate every config, jobs of them at once
+     */
+    vector< evaluation > evaluateAll(const tuning_data &data, const vector< tuner_config > &configs, int jobs) {
+        vector< evaluation > results(configs.size());
+        atomic<size_t> next(0);
+        vector< thread > workers;
+        for(int j = 0; j < min(jobs, (int)configs.size()); j++) {
+            workers.push_back(thread([&] {
+                for(size_t i = next++; i < configs.size(); i = next++)
+                    results[i] = evaluate(data, configs[i]);
+            }));
+        }
+        for(size_t j = 0; j < workers.size(); j++)
+            workers[j].join();
+        return results;
+    }
+
+    /**
+     * One candidate of a pass, the current config with a single parameter changed
+     */
+    struct candidate {
+        tuned_parameter parameter;
+        double value;
+        evaluation result;
+    };
+
+    /**
+     * Every single parameter change from config, all evaluated in parallel
+     */
+    vector< candidate > sweep(const tuning_data &data, const tuner_config &config, int jobs) {
+        vector< candidate > candidates;
+        vector< tuner_config > configs;
+        for(int p = 0; p < TUNE_PARAMETER_COUNT; p++) {
+            tuned_parameter parameter = (tuned_parameter)p;
+            vector< double > values = parameterValues(parameter);
+            for(size_t v = 0; v < values.size(); v++) {
+                if(values[v] == getParameter(config, parameter))
+                    continue;
+                candidate c;
+                c.parameter = parameter;
+                c.value = values[v];
+                candidates.push_back(c);
+                configs.push_back(config);
+                setParameter(configs.back(), parameter, values[v]);
+            }
+        }
+        vector< evaluation > results = evaluateAll(data, configs, jobs);
+        for(size_t c = 0; c < candidates.size(); c++)
+            candidates[c].result = results[c];
+        return candidates;
+    }
+
+    void printEvaluation(const string &label, const evaluation &e) {
+        cout << left << setw(14) << label << right << fixed << setprecision(3) << setw(9) << e.msPerFrame
+             << " ms/frame  recall " << setprecision(4) << e.recall << "  corner error " << setprecision(3)
+             << e.cornerError << " px  extra markers " << e.extraMarkers << endl;
+    }
+
+    /**
+     * Every value of every parameter around the final config: the time and accuracy each one would cost
+     */
+    void printSweep(const tuner_config &config, const evaluation &current, const vector< candidate > &candidates,
+                    double minRecall, double maxCornerError) {
+        cout << endl << "Cost of every value with the others at their tuned value, * marks the ones that keep "
+             << "the recall and accuracy" << endl;
+        for(int p = 0; p < TUNE_PARAMETER_COUNT; p++) {
+            tuned_parameter parameter = (tuned_parameter)p;
+            cout << parameterNames[p] << endl;
+            vector< double > values = parameterValues(parameter);
+            for(size_t v = 0; v < values.size(); v++) {
+                const evaluation *e = nullptr;
+                bool chosen = values[v] == getParameter(config, parameter);
+                if(chosen)
+                    e = &current;
+                for(size_t c = 0; c < candidates.size() && e == nullptr; c++) {
+                    if(candidates[c].parameter == parameter && candidates[c].value == values[v])
+                        e = &candidates[c].result;
+                }
+                cout << "  " << setw(6) << defaultfloat << values[v] << (chosen ? " <" : "  ");
+                if(e == nullptr || !e->valid) {
+                    cout << "   invalid" << endl;
+                    continue;
+                }
+                bool feasible = e->recall >= minRecall && e->cornerError <= maxCornerError;
+                cout << (feasible ? " * " : "   ") << fixed << setprecision(3) << setw(8) << e->msPerFrame
+                     << " ms/frame (" << showpos << e->msPerFrame - current.msPerFrame << noshowpos << ")  recall "
+                     << setprecision(4) << e->recall << "  corner error " << setprecision(3) << e->cornerError
+                     << endl;
+            }
+        }
+    }
+}
+
+/**
+ * example args
+ * -v=recording.framelog -d=11 -dp=aruco_test/charuco_board/detector_params.yml -ref=reference.yml -o=tuned.yml
+ */
+int main(int argc, const char *const argv[]) {
+    CommandLineParser parser(argc, argv, keys);
+    parser.about(about);
+
+    if(argc < 2 || !parser.has("v") || !parser.has("ref")) {
+        parser.printMessage();
+        return 0;
+    }
+
+    string input = parser.get<string>("v");
+    string referenceFile = parser.get<string>("ref");
+    string outputFile = parser.get<string>("o");
+    int dictionaryId = parser.get<int>("d");
+    double minRecall = parser.get<double>("rc");
+    double maxCornerError = parser.get<double>("ce");
+    int frameLimit = max(0, parser.get<int>("n"));
+    int jobs = parser.get<int>("j");
+    if(jobs <= 0)
+        jobs = max(1, (int)thread::hardware_concurrency());
+    double minGain = max(0.0, parser.get<double>("mg"));
+    int passes = max(1, parser.get<int>("pa"));
+
+    tuner_config start;
+    Ptr<aruco::DetectorParameters> detectorParams = aruco::DetectorParameters::create();
+    if(parser.has("dp")) {
+        bool readOk = readDetectorParameters(parser.get<string>("dp"), detectorParams, start.options);
+        if(!readOk) {
+            cerr << "Invalid detector parameters file" << endl;
+            return 1;
+        }
+    }
+    // same override as detect_single and detect_board, so the corners are compared after refinement
+    detectorParams->cornerRefinementMethod = aruco::CORNER_REFINE_SUBPIX;
+    start.params = *detectorParams;
+
+    if(!parser.check()) {
+        parser.printErrors();
+        return 1;
+    }
+
+    tuning_data data;
+    data.dictionary = aruco::getPredefinedDictionary(aruco::PREDEFINED_DICTIONARY_NAME(dictionaryId));
+    data.repetitions = max(1, parser.get<int>("rep"));
+
+    replay_source source;
+    if(!source.open(input)) {
+        cerr << "Could not open " << input << endl;
+        return 1;
+    }
+    Mat image;
+    uint64_t captureUs = 0;
+    frame_result converted;
+    while((frameLimit == 0 || (int)data.frames.size() < frameLimit) && source.read(image, captureUs)) {
+        convertFrame(image, converted);
+        data.frames.push_back(converted.grey.clone());
+    }
+    if(data.frames.empty()) {
+        cerr << "No frames in " << input << endl;
+        return 1;
+    }
+
+    // an existing reference may be curated by hand, it is never overwritten
+    struct stat referenceInfo;
+    bool referenceExists = stat(referenceFile.c_str(), &referenceInfo) == 0;
+    if(referenceExists && !readReference(referenceFile, data.reference)) {
+        cerr << "Invalid reference file " << referenceFile << endl;
+        return 1;
+    }
+    if(!referenceExists) {
+        // the starting parameters become the reference, the search then looks for the same detections faster
+        engine_options engineOptions;
+        engineOptions.target = TARGET_MARKERS;
+        detection_engine engine(data.dictionary, makePtr<aruco::DetectorParameters>(start.params), start.options,
+                                engineOptions);
+        data.reference.resize(data.frames.size());
+        for(size_t f = 0; f < data.frames.size(); f++) {
+            engine.process(data.frames[f]);
+            const engine_results &results = engine.results();
+            data.reference[f].ids = results.ids;
+            for(size_t c = 0; c < results.corners.size(); c++) {
+                data.reference[f].corners.push_back(results.corners[c].x);
+                data.reference[f].corners.push_back(results.corners[c].y);
+            }
+        }
+        if(!writeReference(referenceFile, data.reference)) {
+            cerr << "Could not write " << referenceFile << endl;
+            return 1;
+        }
+        cout << "Wrote the detections of the starting parameters to " << referenceFile << endl;
+    }
+    if(data.reference.size() != data.frames.size()) {
+        cerr << referenceFile << " has " << data.reference.size() << " frames, the footage "
+             << data.frames.size() << endl;
+        return 1;
+    }
+
+    // parameter sets detected side by side would fight over the cores with OpenCV's own threads
+    if(jobs > 1)
+        setNumThreads(1);
+    cout << "Tuning on " << data.frames.size() << " frames, " << jobs << " parameter sets at once" << endl;
+
+    tuner_config current = start;
+    evaluation currentResult = evaluate(data, current);
+    evaluation startResult = currentResult;
+    printEvaluation("start", startResult);
+
+    vector< candidate > candidates;
+    bool converged = false;
+    for(int pass = 0; pass < passes && !converged; pass++) {
+        candidates = sweep(data, current, jobs);
+
+        // the best change of each parameter, best first
+        vector< candidate > moves;
+        for(int p = 0; p < TUNE_PARAMETER_COUNT; p++) {
+            const candidate *best = nullptr;
+            for(size_t c = 0; c < candidates.size(); c++) {
+                if(candidates[c].parameter != p)
+                    continue;
+                if(best == nullptr || better(candidates[c].result, best->result, minRecall, maxCornerError))
+                    best = &candidates[c];
+            }
+            if(best != nullptr)
+                moves.push_back(*best);
+        }
+        sort(moves.begin(), moves.end(), [&](const candidate &a, const candidate &b) {
+            return better(a.result, b.result, minRecall, maxCornerError);
+        });
+
+        // take the best change, then the others one by one for as long as each still gains on top of the last
+        bool moved = false;
+        for(size_t m = 0; m < moves.size(); m++) {
+            tuner_config next = current;
+            setParameter(next, moves[m].parameter, moves[m].value);
+            evaluation result = moved ? evaluate(data, next) : moves[m].result;
+            bool gains = feasible(currentResult, minRecall, maxCornerError)
+                         ? feasible(result, minRecall, maxCornerError) &&
+                           result.msPerFrame < currentResult.msPerFrame * (1 - minGain)
+                         : better(result, currentResult, minRecall, maxCornerError);
+            if(!gains)
+                continue;
+            current = next;
+            currentResult = result;
+            moved = true;
+            cout << "pass " << pass + 1 << ": " << parameterNames[moves[m].parameter] << " = " << defaultfloat
+                 << moves[m].value << endl;
+        }
+        printEvaluation("pass " + to_string(pass + 1), currentResult);
+        converged = !moved;
+    }
+
+    // a pass that changed nothing already swept around the final config
+    if(!converged)
+        candidates = sweep(data, current, jobs);
+    printSweep(current, currentResult, candidates, minRecall, maxCornerError);
+
+    // what each change from the starting file is worth, undoing it alone from the tuned config
+    vector< tuned_parameter > changed;
+    vector< tuner_config > reverted;
+    for(int p = 0; p < TUNE_PARAMETER_COUNT; p++) {
+        tuned_parameter parameter = (tuned_parameter)p;
+        if(getParameter(current, parameter) == getParameter(start, parameter))
+            continue;
+        changed.push_back(parameter);
+        reverted.push_back(current);
+        setParameter(reverted.back(), parameter, getParameter(start, parameter));
+    }
+    vector< evaluation > revertedResults = evaluateAll(data, reverted, jobs);
+    cout << endl << "Attribution, the time each change saves with the other changes kept" << endl;
+    for(size_t i = 0; i < changed.size(); i++) {
+        cout << "  " << left << setw(40) << parameterNames[changed[i]] << right << defaultfloat << setw(6)
+             << getParameter(start, changed[i]) << " -> " << setw(6) << getParameter(current, changed[i]);
+        if(!revertedResults[i].valid) {
+            cout << "   the starting value is invalid with the others" << endl;
+            continue;
+        }
+        cout << fixed << setprecision(3) << setw(9) << revertedResults[i].msPerFrame - currentResult.msPerFrame
+             << " ms/frame saved, recall " << setprecision(4) << showpos
+             << currentResult.recall - revertedResults[i].recall << noshowpos << endl;
+    }
+
+    // the headline numbers alone on the machine, without the other parameter sets competing for it
+    setNumThreads(-1);
+    cout << endl;
+    printEvaluation("start", evaluate(data, start));
+    printEvaluation("tuned", evaluate(data, current));
+
+    if(!feasible(currentResult, minRecall, maxCornerError))
+        cerr << "No parameter set reached a recall of " << minRecall << " within " << maxCornerError
+             << " px, writing the closest one" << endl;
+    if(!writeDetectorParameters(outputFile, current.params, current.options)) {
+        cerr << "Could not write " << outputFile << endl;
+        return 1;
+    }
+    cout << "Wrote " << outputFile << endl;
+    return 0;
+}
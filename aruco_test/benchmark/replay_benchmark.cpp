@@ -0,0 +1,336 @@
+#include <opencv2/aruco.hpp>
+#include <opencv2/aruco/charuco.hpp>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include "../common/detection_engine.h"
+#include "../common/detection_stages.h"
+#include "../common/detector_params.h"
+#include "../common/replay_source.h"
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    const char* about = "Replay recorded footage through the detectors as fast as possible and report timings as JSON";
+    const char* keys  =
+            "{v        |       | Video file, directory of images or frame log to replay }"
+                    "{m        | markers | What the pose is estimated for: markers, board or charuco }"
+                    "{d        |       | dictionary: DICT_4X4_50=0, DICT_4X4_100=1, DICT_4X4_250=2,"
+                    "DICT_4X4_1000=3, DICT_5X5_50=4, DICT_5X5_100=5, DICT_5X5_250=6, DICT_5X5_1000=7, "
+                    "DICT_6X6_50=8, DICT_6X6_100=9, DICT_6X6_250=10, DICT_6X6_1000=11, DICT_7X7_50=12,"
+                    "DICT_7X7_100=13, DICT_7X7_250=14, DICT_7X7_1000=15, DICT_ARUCO_ORIGINAL = 16}"
+                    "{c        |       | Camera intrinsic parameters. Needed for the pose stage }"
+                    "{dp       |       | File of marker detector parameters }"
+                    "{w        |       | Number of squares in X direction (board and charuco) }"
+                    "{h        |       | Number of squares in Y direction (board and charuco) }"
+                    "{l        | 0.1   | Marker side length (markers and board) }"
+                    "{s        |       | Separation between two consecutive markers in the grid (board) }"
+                    "{sl       |       | Square side length (charuco) }"
+                    "{ml       |       | Marker side length (charuco) }"
+                    "{rs       |       | Apply refind strategy (board and charuco) }"
+                    "{tr       | 0     | Track markers, scan only around last frame's markers with a full scan every n frames, 0 disables }"
+                    "{tp       | 0.5   | Tracking padding around each marker, as a fraction of the marker size }"
+                    "{ws       | 0     | Warm start each pose from the previous frame's with at most n Gauss-Newton steps, 0 solves every frame from scratch }"
+                    "{ud       | 0     | Undistort corners through a lookup table with a node every n pixels before solving poses, 0 leaves it to the solvers unless the calibration is fisheye }"
+                    "{ap       |       | Adapt the perimeter range, threshold windows and pixels per cell to the sizes and contrast of the last frames' markers, widening them again when markers drop out }"
+                    "{sq       |       | Solve marker poses with the closed form square solver instead of estimatePoseSingleMarkers }"
+                    "{kf       |       | Filter the poses per id, the filter predicts the tracking regions }"
+                    "{fr       | 30    | Frame rate the replayed frames are stamped with for the pose filter, frame logs keep their recorded stamps }"
+                    "{pre      |       | Decode every frame into memory before timing, so the read stage measures nothing but a copy }"
+                    "{wu       | 0     | Warm up frames, processed but left out of the statistics }"
+                    "{o        |       | Write the JSON report to this file instead of stdout }";
+}
+
+/**
+ * Per frame durations of one stage in milliseconds
+ */
+struct stage_samples {
+    string name;
+    vector< double > ms;
+
+    explicit stage_samples(const string &name) : name(name) {}
+};
+
+/**
+ * Nearest rank percentile of sorted samples
+ */
+static double percentile(const vector< double > &sorted, double p) {
+    if(sorted.empty())
+        return 0;
+    size_t rank = (size_t)ceil(p / 100.0 * sorted.size());
+    return sorted[min(sorted.size(), max((size_t)1, rank)) - 1];
+}
+
+static string jsonString(const string &value) {
+    string out = "\"";
+    for(size_t i = 0; i < value.size(); i++) {
+        char c = value[i];
+        if(c == '"' || c == '\\')
+            out += '\\';
+        out += c;
+    }
+    return out + "\"";
+}
+
+static double elapsedMs(int64 from, int64 to) {
+    return (double)(to - from) * 1000.0 / getTickFrequency();
+}
+
+/**
+ * example args
+ * -v=recording.avi -m=charuco -w=5 -h=7 -sl=.033 -ml=.025 -d=11 -dp=aruco_test/charuco_board/detector_params.yml -c=aruco_test/charuco_board/default.yml -o=report.json
+ */
+int main(int argc, const char *const argv[]) {
+    CommandLineParser parser(argc, argv, keys);
+    parser.about(about);
+
+    if(argc < 2 || !parser.has("v")) {
+        parser.printMessage();
+        return 0;
+    }
+
+    string input = parser.get<string>("v");
+    string mode = parser.get<string>("m");
+    int dictionaryId = parser.get<int>("d");
+    bool preload = parser.has("pre");
+    int warmup = max(0, parser.get<int>("wu"));
+
+    engine_options engineOptions;
+    if(mode == "markers") {
+        engineOptions.target = TARGET_MARKERS;
+    } else if(mode == "board") {
+        engineOptions.target = TARGET_GRID_BOARD;
+    } else if(mode == "charuco") {
+        engineOptions.target = TARGET_CHARUCO_BOARD;
+    } else {
+        cerr << "Unknown mode " << mode << ", use markers, board or charuco" << endl;
+        return 1;
+    }
+
+    Mat camMatrix, distCoeffs;
+    Size calibratedSize;
+    bool fisheye = false;
+    if(parser.has("c")) {
+        bool readOk = readCameraParameters(parser.get<string>("c"), camMatrix, distCoeffs, calibratedSize, fisheye);
+        if(!readOk) {
+            cerr << "Invalid camera file" << endl;
+            return 1;
+        }
+    }
+
+    Ptr<aruco::DetectorParameters> detectorParams = aruco::DetectorParameters::create();
+    detector_options detectorOptions;
+    if(parser.has("dp")) {
+        bool readOk = readDetectorParameters(parser.get<string>("dp"), detectorParams, detectorOptions);
+        if(!readOk) {
+            cerr << "Invalid detector parameters file" << endl;
+            return 1;
+        }
+    }
+    // same override as detect_single and detect_board, detect_board_charuco takes the file as is
+    if(engineOptions.target != TARGET_CHARUCO_BOARD)
+        detectorParams->cornerRefinementMethod = aruco::CORNER_REFINE_SUBPIX;
+
+    if(!parser.check()) {
+        parser.printErrors();
+        return 1;
+    }
+
+    Ptr<aruco::Dictionary> dictionary =
+            aruco::getPredefinedDictionary(aruco::PREDEFINED_DICTIONARY_NAME(dictionaryId));
+    engineOptions.markerLength = parser.get<float>("l");
+    engineOptions.refindStrategy = parser.has("rs");
+    if(engineOptions.target == TARGET_GRID_BOARD) {
+        Ptr<aruco::GridBoard> gridboard =
+                aruco::GridBoard::create(parser.get<int>("w"), parser.get<int>("h"), parser.get<float>("l"),
+                                         parser.get<float>("s"), dictionary);
+        engineOptions.board = gridboard.staticCast<aruco::Board>();
+    } else if(engineOptions.target == TARGET_CHARUCO_BOARD) {
+        engineOptions.charucoBoard =
+                aruco::CharucoBoard::create(parser.get<int>("w"), parser.get<int>("h"), parser.get<float>("sl"),
+                                            parser.get<float>("ml"), dictionary);
+        engineOptions.board = engineOptions.charucoBoard.staticCast<aruco::Board>();
+    }
+    engineOptions.trackPeriod = parser.get<int>("tr");
+    engineOptions.trackPadding = parser.get<float>("tp");
+    engineOptions.filterPoses = parser.has("kf");
+    engineOptions.warmIterations = parser.get<int>("ws");
+    engineOptions.squareSolver = parser.has("sq");
+    engineOptions.undistortCell = parser.get<int>("ud");
+    engineOptions.adaptParams = parser.has("ap");
+
+    // the stages are timed one by one on the engine's setup, the detectors run them all through process
+    detection_engine engine(dictionary, detectorParams, detectorOptions, engineOptions);
+    engine.setCalibration(camMatrix, distCoeffs, calibratedSize, fisheye);
+    const detection_setup &setup = engine.setup();
+    double frameRate = max(1.0, parser.get<double>("fr"));
+
+    replay_source source;
+    if(!source.open(input)) {
+        cerr << "Could not open " << input << endl;
+        return 1;
+    }
+
+    vector< Mat > preloaded;
+    vector< uint64_t > preloadedUs;
+    if(preload) {
+        Mat image;
+        uint64_t captureUs = (uint64_t)((preloaded.size() + 1) * 1e6 / frameRate);
+        while(source.read(image, captureUs)) {
+            preloaded.push_back(image.clone());
+            preloadedUs.push_back(captureUs);
+            captureUs = (uint64_t)((preloaded.size() + 1) * 1e6 / frameRate);
+        }
+    }
+
+    // only the stages the target runs are reported
+    stage_samples readStage("read"), convertStage("convert"), detectStage("detect"), refineStage("refine"),
+            interpolateStage("interpolate"), poseStage("pose"), filterStage("filter"), totalStage("total");
+    vector< stage_samples * > stages;
+    stages.push_back(&readStage);
+    stages.push_back(&convertStage);
+    stages.push_back(&detectStage);
+    if(setup.refindStrategy && setup.target != TARGET_MARKERS)
+        stages.push_back(&refineStage);
+    if(setup.target == TARGET_CHARUCO_BOARD)
+        stages.push_back(&interpolateStage);
+    if(setup.canEstimatePose())
+        stages.push_back(&poseStage);
+    if(setup.poseFilter)
+        stages.push_back(&filterStage);
+    stages.push_back(&totalStage);
+
+    long framesWithMarkers = 0, markers = 0, framesWithPose = 0, charucoCorners = 0;
+    map< int, long > idCounts;
+
+    frame_result result;
+    Mat image;
+    int frameIndex = 0;
+    size_t nextPreloaded = 0;
+    int64 start = 0;
+    for(;;) {
+        if(frameIndex == warmup)
+            start = getTickCount();
+
+        int64 t0 = getTickCount();
+        uint64_t captureUs = (uint64_t)((frameIndex + 1) * 1e6 / frameRate);
+        if(preload) {
+            if(nextPreloaded == preloaded.size())
+                break;
+            captureUs = preloadedUs[nextPreloaded];
+            image = preloaded[nextPreloaded++];
+        } else if(!source.read(image, captureUs)) {
+            break;
+        }
+        int64 t1 = getTickCount();
+        convertFrame(image, result);
+        int64 t2 = getTickCount();
+        detectFrameMarkers(setup, result.grey, result, captureUs);
+        int64 t3 = getTickCount();
+        refineFrameMarkers(setup, result.grey, result);
+        int64 t4 = getTickCount();
+        interpolateFrameCharuco(setup, result.grey, result);
+        int64 t5 = getTickCount();
+        estimateFramePose(setup, result);
+        int64 t6 = getTickCount();
+        filterFramePoses(setup, captureUs, result);
+        int64 t7 = getTickCount();
+
+        if(frameIndex++ < warmup)
+            continue;
+
+        readStage.ms.push_back(elapsedMs(t0, t1));
+        convertStage.ms.push_back(elapsedMs(t1, t2));
+        detectStage.ms.push_back(elapsedMs(t2, t3));
+        refineStage.ms.push_back(elapsedMs(t3, t4));
+        interpolateStage.ms.push_back(elapsedMs(t4, t5));
+        poseStage.ms.push_back(elapsedMs(t5, t6));
+        filterStage.ms.push_back(elapsedMs(t6, t7));
+        totalStage.ms.push_back(elapsedMs(t1, t7));
+
+        if(!result.ids.empty())
+            framesWithMarkers++;
+        markers += (long)result.ids.size();
+        if(!result.tvecs.empty())
+            framesWithPose++;
+        charucoCorners += (long)result.charucoIds.size();
+        for(size_t i = 0; i < result.ids.size(); i++)
+            idCounts[result.ids[i]]++;
+    }
+    int64 end = getTickCount();
+
+    size_t frames = totalStage.ms.size();
+    double wallSeconds = frames > 0 ? elapsedMs(start, end) / 1000.0 : 0;
+    double processingSeconds = 0;
+    for(size_t i = 0; i < frames; i++)
+        processingSeconds += totalStage.ms[i] / 1000.0;
+
+    ofstream file;
+    if(parser.has("o")) {
+        file.open(parser.get<string>("o").c_str());
+        if(!file.is_open()) {
+            cerr << "Could not write " << parser.get<string>("o") << endl;
+            return 1;
+        }
+    }
+    ostream &out = file.is_open() ? file : cout;
+
+    out << "{\n";
+    out << "  \"input\": " << jsonString(input) << ",\n";
+    out << "  \"mode\": " << jsonString(mode) << ",\n";
+    out << "  \"parameters\": " << jsonString(parser.has("dp") ? parser.get<string>("dp") : "") << ",\n";
+    out << "  \"decimation\": " << detectorOptions.decimation << ",\n";
+    out << "  \"integralThreshold\": " << (detectorOptions.integralThreshold ? "true" : "false") << ",\n";
+    out << "  \"tracking\": " << max(0, engineOptions.trackPeriod) << ",\n";
+    out << "  \"poseFilter\": " << (setup.poseFilter ? "true" : "false") << ",\n";
+    out << "  \"warmStartIterations\": " << (setup.warmStart ? engineOptions.warmIterations : 0) << ",\n";
+    out << "  \"squareSolver\": " << (setup.squareSolver ? "true" : "false") << ",\n";
+    out << "  \"undistortMap\": " << (setup.undistortMap ? "true" : "false") << ",\n";
+    out << "  \"adaptiveParameters\": " << (setup.adaptive ? "true" : "false") << ",\n";
+    out << "  \"adaptiveNarrowedFrames\": " << (setup.adaptive ? setup.adaptive->narrowedFrames() : 0) << ",\n";
+    out << "  \"preloaded\": " << (preload ? "true" : "false") << ",\n";
+    out << "  \"warmupFrames\": " << min(warmup, frameIndex) << ",\n";
+    out << "  \"frames\": " << frames << ",\n";
+    out << "  \"wallSeconds\": " << wallSeconds << ",\n";
+    out << "  \"fps\": " << (wallSeconds > 0 ? frames / wallSeconds : 0) << ",\n";
+    out << "  \"processingFps\": " << (processingSeconds > 0 ? frames / processingSeconds : 0) << ",\n";
+
+    out << "  \"stagesMs\": {\n";
+    for(size_t s = 0; s < stages.size(); s++) {
+        vector< double > sorted = stages[s]->ms;
+        sort(sorted.begin(), sorted.end());
+        double sum = 0;
+        for(size_t i = 0; i < sorted.size(); i++)
+            sum += sorted[i];
+        out << "    " << jsonString(stages[s]->name) << ": {"
+            << "\"mean\": " << (sorted.empty() ? 0 : sum / sorted.size())
+            << ", \"p50\": " << percentile(sorted, 50)
+            << ", \"p90\": " << percentile(sorted, 90)
+            << ", \"p99\": " << percentile(sorted, 99)
+            << ", \"max\": " << (sorted.empty() ? 0 : sorted.back()) << "}"
+            << (s + 1 < stages.size() ? "," : "") << "\n";
+    }
+    out << "  },\n";
+
+    out << "  \"detections\": {\n";
+    out << "    \"framesWithMarkers\": " << framesWithMarkers << ",\n";
+    out << "    \"markers\": " << markers << ",\n";
+    out << "    \"framesWithPose\": " << framesWithPose << ",\n";
+    out << "    \"charucoCorners\": " << charucoCorners << ",\n";
+    if(setup.warmStart) {
+        // counts include the warm up frames
+        out << "    \"warmSolves\": " << setup.warmStart->warmSolves() << ",\n";
+        out << "    \"coldSolves\": " << setup.warmStart->coldSolves() << ",\n";
+    }
+    out << "    \"ids\": {";
+    for(map< int, long >::const_iterator it = idCounts.begin(); it != idCounts.end(); ++it)
+        out << (it == idCounts.begin() ? "" : ", ") << "\"" << it->first << "\": " << it->second;
+    out << "}\n";
+    out << "  }\n";
+    out << "}\n";
+
+    return 0;
+}
@@ -0,0 +1,205 @@
+#include "bit_decoder.h"
+
+#include <cfloat>
+#include <cmath>
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    /**
+     * Square to quadrilateral homography in closed form (Heckbert): the unit square's corners (0, 0),
+     * (1, 0), (1, 1) and (0, 1) go to the four corners
+     */
+    struct square_map {
+        double a, b, c, d, e, f, g, h;
+
+        bool fit(const vector< Point2f > &q) {
+            double dx1 = q[1].x - q[2].x, dx2 = q[3].x - q[2].x, dx3 = q[0].x - q[1].x + q[2].x - q[3].x;
+            double dy1 = q[1].y - q[2].y, dy2 = q[3].y - q[2].y, dy3 = q[0].y - q[1].y + q[2].y - q[3].y;
+            double det = dx1 * dy2 - dx2 * dy1;
+            if(fabs(det) < DBL_EPSILON)
+                return false;
+            g = (dx3 * dy2 - dx2 * dy3) / det;
+            h = (dx1 * dy3 - dx3 * dy1) / det;
+            a = q[1].x - q[0].x + g * q[1].x;
+            b = q[3].x - q[0].x + h * q[3].x;
+            c = q[0].x;
+            d = q[1].y - q[0].y + g * q[1].y;
+            e = q[3].y - q[0].y + h * q[3].y;
+            f = q[0].y;
+            return true;
+        }
+    };
+
+    /**
+     * Frame pixels behind the warped image of side size, nearest neighbour and black outside the frame
+     * like warpPerspective's defaults. Visits the warped pixels row by row.
+     */
+    class grid_sampler {
+    public:
+        grid_sampler(const Mat &grey, const square_map &map, int size)
+                : grey(grey), map(map), scale(size > 1 ? 1.0 / (size - 1) : 0) {}
+
+        uchar at(int u, int v) const {
+            double s = u * scale, t = v * scale;
+            double w = map.g * s + map.h * t + 1;
+            w = w != 0 ? 1. / w : 0;
+            int x = cvRound((map.a * s + map.b * t + map.c) * w);
+            int y = cvRound((map.d * s + map.e * t + map.f) * w);
+            if((unsigned)x >= (unsigned)grey.cols || (unsigned)y >= (unsigned)grey.rows)
+                return 0;
+            return grey.ptr< uchar >(y)[x];
+        }
+
+    private:
+        const Mat &grey;
+        const square_map &map;
+        double scale;
+    };
+
+    /**
+     * Threshold of cv::threshold with THRESH_OTSU for a histogram of count pixels
+     */
+    int otsuThreshold(const int histogram[256], int count) {
+        double mu = 0, scale = 1. / count;
+        for(int i = 0; i < 256; i++)
+            mu += i * (double)histogram[i];
+        mu *= scale;
+
+        double mu1 = 0, q1 = 0, maxSigma = 0;
+        int threshold = 0;
+        for(int i = 0; i < 256; i++) {
+            double p = histogram[i] * scale;
+            mu1 *= q1;
+            q1 += p;
+            double q2 = 1. - q1;
+            if(min(q1, q2) < FLT_EPSILON || max(q1, q2) > 1. - FLT_EPSILON)
+                continue;
+            mu1 = (mu1 + i * p) / q1;
+            double mu2 = (mu - q1 * mu1) / q2;
+            double sigma = q1 * q2 * (mu1 - mu2) * (mu1 - mu2);
+            if(sigma > maxSigma) {
+                maxSigma = sigma;
+                threshold = i;
+            }
+        }
+        return threshold;
+    }
+
+    /**
+     * Decoder of MarkerSize x MarkerSize markers inside a border of BorderBits cells
+     */
+    template< int MarkerSize, int BorderBits >
+    class grid_decoder : public bit_decoder {
+    public:
+        static constexpr int cells = MarkerSize + 2 * BorderBits;
+        static constexpr int bits = MarkerSize * MarkerSize;
+
+        static constexpr bool isBorder(int y, int x) {
+            return y < BorderBits || x < BorderBits || y >= cells - BorderBits || x >= cells - BorderBits;
+        }
+
+        /**
+         * Bit of inner cell i in the code, row major with each byte filled from its high bit and the last
+         * partial byte keeping its bits at the bottom, Dictionary::getByteListFromBits order
+         */
+        static constexpr int codeBit(int i) {
+            return 8 * (i / 8) + ((bits - 8 * (i / 8) < 8 ? bits - 8 * (i / 8) : 8) - 1 - i % 8);
+        }
+
+        static constexpr int innerIndex(int y, int x) {
+            return (y - BorderBits) * MarkerSize + (x - BorderBits);
+        }
+
+        bool decode(const Mat &grey, const vector< Point2f > &corners, const aruco::DetectorParameters &params,
+                    uint64_t &code, int &borderErrors) const override {
+            square_map map;
+            if(corners.size() != 4 || !map.fit(corners))
+                return false;
+            int cellSize = params.perspectiveRemovePixelPerCell;
+            int size = cells * cellSize;
+            int margin = int(params.perspectiveRemoveIgnoredMarginPerCell * cellSize);
+            grid_sampler sampler(grey, map, size);
+
+            // Otsu histogram of the whole warped image, contrast of all but its outer half cell
+            int histogram[256] = {0};
+            double sum = 0, sumSquares = 0;
+            int innerStart = cellSize / 2, innerEnd = size - cellSize / 2;
+            for(int v = 0; v < size; v++) {
+                for(int u = 0; u < size; u++) {
+                    uchar value = sampler.at(u, v);
+                    histogram[value]++;
+                    if(v >= innerStart && v < innerEnd && u >= innerStart && u < innerEnd) {
+                        sum += value;
+                        sumSquares += (double)value * value;
+                    }
+                }
+            }
+
+            code = 0;
+            borderErrors = 0;
+            int innerCount = (innerEnd - innerStart) * (innerEnd - innerStart);
+            double mean = innerCount > 0 ? sum / innerCount : 0;
+            double variance = innerCount > 0 ? sumSquares / innerCount - mean * mean : 0;
+            if(sqrt(max(0.0, variance)) < params.minOtsuStdDev) {
+                // every cell has the same color
+                if(mean > 127) {
+                    for(int y = 0; y < cells; y++)
+                        for(int x = 0; x < cells; x++)
+                            borderErrors += isBorder(y, x);
+                    code = bits == 64 ? ~(uint64_t)0 : (((uint64_t)1 << bits) - 1);
+                }
+                return true;
+            }
+            int threshold = otsuThreshold(histogram, size * size);
+
+            int side = cellSize - 2 * margin;
+            int half = side > 0 ? side * side / 2 : 0;
+            for(int y = 0; y < cells; y++) {
+                for(int x = 0; x < cells; x++) {
+                    int white = 0;
+                    for(int v = y * cellSize + margin; v < y * cellSize + margin + side; v++)
+                        for(int u = x * cellSize + margin; u < x * cellSize + margin + side; u++)
+                            white += sampler.at(u, v) > threshold;
+                    uint64_t bit = white > half;
+                    if(isBorder(y, x))
+                        borderErrors += (int)bit;
+                    else
+                        code |= bit << codeBit(innerIndex(y, x));
+                }
+            }
+            return true;
+        }
+
+        int markerSize() const override { return MarkerSize; }
+        int borderBits() const override { return BorderBits; }
+    };
+
+    template< int MarkerSize >
+    Ptr<bit_decoder> createForBorder(int borderBits) {
+        switch(borderBits) {
+            case 1:
+                return makePtr< grid_decoder< MarkerSize, 1 > >();
+            case 2:
+                return makePtr< grid_decoder< MarkerSize, 2 > >();
+            default:
+                return Ptr<bit_decoder>();
+        }
+    }
+}
+
+Ptr<bit_decoder> bit_decoder::create(int markerSize, int borderBits) {
+    switch(markerSize) {
+        case 4:
+            return createForBorder< 4 >(borderBits);
+        case 5:
+            return createForBorder< 5 >(borderBits);
+        case 6:
+            return createForBorder< 6 >(borderBits);
+        case 7:
+            return createForBorder< 7 >(borderBits);
+        default:
+            return Ptr<bit_decoder>();
+    }
+}
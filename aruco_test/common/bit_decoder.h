@@ -0,0 +1,44 @@
+//
+// Bit extraction of marker candidates compiled for each grid size.
+//
+
+#ifndef ARUCO_TEST_BIT_DECODER_H
+#define ARUCO_TEST_BIT_DECODER_H
+
+#include <opencv2/aruco.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Reads the cells of a candidate straight from the frame, without the warped image, Otsu and cell Mats
+ * of the generic extraction. The grid size and border width are template parameters of the
+ * implementations, so the cell loops unroll and the border and bit position of every cell are compile
+ * time constants. Inner bits are packed in the layout of dictionary_index.
+ */
+class bit_decoder {
+public:
+    virtual ~bit_decoder() {}
+
+    /**
+     * Sample the candidate's cells the way warpPerspective with INTER_NEAREST followed by an Otsu
+     * threshold reads them
+     *
+     * @param corners the four candidate corners, clockwise
+     * @param code inner bits, see dictionary_index::packBits
+     * @param borderErrors border cells that are not black
+     * @return false for corners no homography maps the grid to
+     */
+    virtual bool decode(const cv::Mat &grey, const std::vector< cv::Point2f > &corners,
+                        const cv::aruco::DetectorParameters &params, uint64_t &code, int &borderErrors) const = 0;
+
+    virtual int markerSize() const = 0;
+    virtual int borderBits() const = 0;
+
+    /**
+     * The decoder of a grid, empty for sizes other than 4x4 to 7x7 with a border of 1 or 2 cells
+     */
+    static cv::Ptr<bit_decoder> create(int markerSize, int borderBits);
+};
+
+
+#endif //ARUCO_TEST_BIT_DECODER_H
@@ -0,0 +1,484 @@
+#include "capture_source.h"
+#include "frame_log.h"
+
+#include <opencv2/videoio.hpp>
+#include <linux/videodev2.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    // a camera that stops delivering for this long is taken for gone
+    const int frameTimeoutMs = 2000;
+
+    bool isNumber(const string &text) {
+        return !text.empty() && text.find_first_not_of("0123456789") == string::npos;
+    }
+
+    /**
+     * Copy the luma of a YUYV frame, every other byte of each row
+     */
+    void extractLuma(const uchar *yuyv, size_t step, Mat &grey) {
+        for(int y = 0; y < grey.rows; y++) {
+            const uchar *src = yuyv + y * step;
+            uchar *dst = grey.ptr< uchar >(y);
+            for(int x = 0; x < grey.cols; x++)
+                dst[x] = src[2 * x];
+        }
+    }
+
+    /**
+     * A pooled buffer for the luma of a YUYV frame, an ordinary Mat when the pool is exhausted
+     */
+    void lumaBuffer(frame_pool &pool, const Size &size, frame_handle &frame) {
+        if(!pool.acquire(frame))
+            frame = frame_handle(Mat(size, CV_8UC1));
+    }
+
+    int xioctl(int fd, unsigned long request, void *argument) {
+        int result;
+        do {
+            result = ioctl(fd, request, argument);
+        } while(result < 0 && errno == EINTR);
+        return result;
+    }
+
+    /**
+     * VideoCapture, frames retrieved into a frame_pool
+     */
+    class opencv_source : public capture_source {
+    public:
+        explicit opencv_source(const capture_options &options) : pool(options.bufferCount, options.pages) {}
+
+        bool open(const string &source) {
+            if(isNumber(source))
+                capture.open(atoi(source.c_str()));
+            else
+                capture.open(source);
+            if(!capture.isOpened())
+                cerr << "Could not open " << source << endl;
+            return capture.isOpened();
+        }
+
+        bool grab() override { return capture.grab(); }
+        bool retrieve(frame_handle &frame) override { return pool.retrieve(capture, frame); }
+        size_t exhaustedCount() const override { return pool.exhaustedCount(); }
+        size_t mismatchCount() const override { return pool.mismatchCount(); }
+
+    private:
+        VideoCapture capture;
+        frame_pool pool;
+    };
+
+    /**
+     * V4L2 streaming capture on driver buffers mapped into the process. A GREY frame is handed out as its
+     * driver buffer, which is queued back to the driver when the last handle lets go of it. A YUYV buffer
+     * goes back as soon as its luma is copied out.
+     */
+    class v4l2_source : public capture_source, public frame_owner {
+    public:
+        explicit v4l2_source(const capture_options &options)
+                : options(options), lumaPool(options.bufferCount, options.pages), waits(0) {}
+
+        ~v4l2_source() override {
+            if(fd < 0)
+                return;
+            v4l2_buf_type type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+            xioctl(fd, VIDIOC_STREAMOFF, &type);
+            for(size_t i = 0; i < slots.size(); i++) {
+                if(slots[i].data != nullptr)
+                    munmap(slots[i].data, lengths[i]);
+            }
+            ::close(fd);
+        }
+
+        bool open(const string &device) {
+            fd = ::open(device.c_str(), O_RDWR | O_NONBLOCK);
+            if(fd < 0) {
+                cerr << "Could not open " << device << ": " << strerror(errno) << endl;
+                return false;
+            }
+
+            v4l2_capability capability;
+            memset(&capability, 0, sizeof(capability));
+            if(xioctl(fd, VIDIOC_QUERYCAP, &capability) < 0) {
+                cerr << device << " is not a V4L2 device" << endl;
+                return false;
+            }
+            uint32_t caps = (capability.capabilities & V4L2_CAP_DEVICE_CAPS) ? capability.device_caps
+                                                                              : capability.capabilities;
+            if(!(caps & V4L2_CAP_VIDEO_CAPTURE) || !(caps & V4L2_CAP_STREAMING)) {
+                cerr << device << " can not stream video capture" << endl;
+                return false;
+            }
+
+            uint32_t pixelFormat = options.format == CAPTURE_YUYV ? V4L2_PIX_FMT_YUYV : V4L2_PIX_FMT_GREY;
+            v4l2_format format;
+            memset(&format, 0, sizeof(format));
+            format.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+            format.fmt.pix.width = (uint32_t)options.frameSize.width;
+            format.fmt.pix.height = (uint32_t)options.frameSize.height;
+            format.fmt.pix.pixelformat = pixelFormat;
+            format.fmt.pix.field = V4L2_FIELD_NONE;
+            if(xioctl(fd, VIDIOC_S_FMT, &format) < 0 || format.fmt.pix.pixelformat != pixelFormat) {
+                cerr << device << " does not deliver " << (options.format == CAPTURE_YUYV ? "YUYV" : "GREY")
+                     << " frames" << endl;
+                return false;
+            }
+            // the driver picks the nearest size it supports
+            frameSize = Size((int)format.fmt.pix.width, (int)format.fmt.pix.height);
+            if(frameSize != options.frameSize)
+                cout << device << " delivers " << frameSize.width << "x" << frameSize.height << " frames" << endl;
+            int bytesPerPixel = options.format == CAPTURE_YUYV ? 2 : 1;
+            step = max((size_t)format.fmt.pix.bytesperline, (size_t)frameSize.width * bytesPerPixel);
+
+            v4l2_requestbuffers request;
+            memset(&request, 0, sizeof(request));
+            request.count = (uint32_t)max((size_t)2, options.bufferCount);
+            request.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+            request.memory = V4L2_MEMORY_MMAP;
+            if(xioctl(fd, VIDIOC_REQBUFS, &request) < 0 || request.count < 2) {
+                cerr << device << " has no memory mapped streaming buffers" << endl;
+                return false;
+            }
+
+            vector< buffer_slot > driverSlots(request.count);
+            slots.swap(driverSlots);
+            lengths.assign(slots.size(), 0);
+            for(size_t i = 0; i < slots.size(); i++) {
+                slots[i].owner = this;
+                slots[i].data = nullptr;
+                slots[i].references = 0;
+
+                v4l2_buffer buffer;
+                memset(&buffer, 0, sizeof(buffer));
+                buffer.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+                buffer.memory = V4L2_MEMORY_MMAP;
+                buffer.index = (uint32_t)i;
+                if(xioctl(fd, VIDIOC_QUERYBUF, &buffer) < 0) {
+                    cerr << "Could not query buffer " << i << " of " << device << endl;
+                    return false;
+                }
+                void *data = mmap(nullptr, buffer.length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, buffer.m.offset);
+                if(data == MAP_FAILED) {
+                    cerr << "Could not map buffer " << i << " of " << device << ": " << strerror(errno) << endl;
+                    return false;
+                }
+                slots[i].data = static_cast< uchar * >(data);
+                lengths[i] = buffer.length;
+            }
+            for(size_t i = 0; i < slots.size(); i++) {
+                if(!queue(i)) {
+                    cerr << "Could not queue buffer " << i << " of " << device << endl;
+                    return false;
+                }
+            }
+
+            v4l2_buf_type type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+            if(xioctl(fd, VIDIOC_STREAMON, &type) < 0) {
+                cerr << "Could not start streaming " << device << ": " << strerror(errno) << endl;
+                return false;
+            }
+            if(options.format == CAPTURE_YUYV)
+                lumaPool.reserve(frameSize, CV_8UC1);
+            return true;
+        }
+
+        bool grab() override {
+            // a frame grabbed but never retrieved goes straight back
+            if(grabbed >= 0) {
+                queue((size_t)grabbed);
+                grabbed = -1;
+            }
+            {
+                // the driver has nothing to fill while the consumers hold every buffer
+                unique_lock<std::mutex> lock(mutex);
+                if(queued == 0) {
+                    waits.fetch_add(1, memory_order_relaxed);
+                    returned.wait(lock, [this] { return queued > 0; });
+                }
+            }
+
+            for(;;) {
+                pollfd ready;
+                ready.fd = fd;
+                ready.events = POLLIN;
+                ready.revents = 0;
+                int result = poll(&ready, 1, frameTimeoutMs);
+                if(result < 0 && errno == EINTR)
+                    continue;
+                if(result <= 0)
+                    return false;
+
+                v4l2_buffer buffer;
+                memset(&buffer, 0, sizeof(buffer));
+                buffer.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+                buffer.memory = V4L2_MEMORY_MMAP;
+                if(xioctl(fd, VIDIOC_DQBUF, &buffer) < 0) {
+                    if(errno == EAGAIN)
+                        continue;
+                    return false;
+                }
+                {
+                    lock_guard<std::mutex> lock(mutex);
+                    queued--;
+                }
+                if(buffer.flags & V4L2_BUF_FLAG_ERROR) {
+                    queue(buffer.index);
+                    continue;
+                }
+                grabbed = (int)buffer.index;
+                return true;
+            }
+        }
+
+        bool retrieve(frame_handle &frame) override {
+            if(grabbed < 0)
+                return false;
+            size_t index = (size_t)grabbed;
+            grabbed = -1;
+
+            if(options.format == CAPTURE_GREY) {
+                handOut(&slots[index], Mat(frameSize, CV_8UC1, slots[index].data, step), frame);
+                return true;
+            }
+            lumaBuffer(lumaPool, frameSize, frame);
+            extractLuma(slots[index].data, step, frame.mat());
+            queue(index);
+            return true;
+        }
+
+        size_t exhaustedCount() const override {
+            return waits.load(memory_order_relaxed) + lumaPool.exhaustedCount();
+        }
+
+    protected:
+        void put(buffer_slot *buffer) override {
+            queue((size_t)(buffer - &slots[0]));
+        }
+
+    private:
+        bool queue(size_t index) {
+            v4l2_buffer buffer;
+            memset(&buffer, 0, sizeof(buffer));
+            buffer.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+            buffer.memory = V4L2_MEMORY_MMAP;
+            buffer.index = (uint32_t)index;
+            if(xioctl(fd, VIDIOC_QBUF, &buffer) < 0)
+                return false;
+            lock_guard<std::mutex> lock(mutex);
+            queued++;
+            returned.notify_one();
+            return true;
+        }
+
+        capture_options options;
+        int fd = -1;
+        Size frameSize;
+        size_t step = 0;
+        vector< buffer_slot > slots;
+        vector< size_t > lengths;
+        int grabbed = -1;
+
+        std::mutex mutex;
+        condition_variable returned;
+        size_t queued = 0;
+
+        frame_pool lumaPool;
+        atomic<size_t> waits;
+    };
+
+    /**
+     * Raw frames back to back in a file, mapped copy on write so the frames can be handed out in place
+     */
+    class raw_file_source : public capture_source {
+    public:
+        explicit raw_file_source(const capture_options &options)
+                : options(options), lumaPool(options.bufferCount, options.pages) {}
+
+        ~raw_file_source() override {
+            if(mapping != nullptr)
+                munmap(mapping, mappingSize);
+        }
+
+        bool open(const string &path) {
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if(fd < 0) {
+                cerr << "Could not open " << path << ": " << strerror(errno) << endl;
+                return false;
+            }
+            struct stat info;
+            if(fstat(fd, &info) < 0) {
+                ::close(fd);
+                return false;
+            }
+            mappingSize = (size_t)info.st_size;
+            frameBytes = (size_t)options.frameSize.area() * (options.format == CAPTURE_YUYV ? 2 : 1);
+            if(frameBytes == 0 || mappingSize < frameBytes) {
+                cerr << path << " holds no whole " << options.frameSize.width << "x" << options.frameSize.height
+                     << " frame" << endl;
+                ::close(fd);
+                return false;
+            }
+            void *data = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if(data == MAP_FAILED) {
+                cerr << "Could not map " << path << ": " << strerror(errno) << endl;
+                return false;
+            }
+            mapping = static_cast< uchar * >(data);
+            madvise(mapping, mappingSize, MADV_SEQUENTIAL);
+            frameCount = mappingSize / frameBytes;
+            if(options.format == CAPTURE_YUYV)
+                lumaPool.reserve(options.frameSize, CV_8UC1);
+            return true;
+        }
+
+        bool grab() override {
+            if(next >= frameCount)
+                return false;
+            grabbed = next++;
+            return true;
+        }
+
+        bool retrieve(frame_handle &frame) override {
+            if(grabbed == noFrame)
+                return false;
+            uchar *data = mapping + grabbed * frameBytes;
+            grabbed = noFrame;
+
+            if(options.format == CAPTURE_GREY) {
+                frame = frame_handle(Mat(options.frameSize, CV_8UC1, data));
+                return true;
+            }
+            lumaBuffer(lumaPool, options.frameSize, frame);
+            extractLuma(data, (size_t)options.frameSize.width * 2, frame.mat());
+            return true;
+        }
+
+        size_t exhaustedCount() const override { return lumaPool.exhaustedCount(); }
+
+    private:
+        static const size_t noFrame = (size_t)-1;
+
+        capture_options options;
+        uchar *mapping = nullptr;
+        size_t mappingSize = 0;
+        size_t frameBytes = 0;
+        size_t frameCount = 0;
+        size_t next = 0;
+        size_t grabbed = noFrame;
+        frame_pool lumaPool;
+    };
+
+    /**
+     * Frames of a frame log with the stamps they were captured with. Raw records are handed out in place,
+     * packed ones are unpacked into pooled buffers.
+     */
+    class frame_log_source : public capture_source {
+    public:
+        explicit frame_log_source(const capture_options &options) : pool(options.bufferCount, options.pages) {}
+
+        bool open(const string &path) { return log.open(path); }
+
+        bool grab() override { return log.next(stamp); }
+
+        bool retrieve(frame_handle &frame) override {
+            if(!log.packed()) {
+                Mat image;
+                if(!log.frame(image))
+                    return false;
+                frame = frame_handle(image);
+                return true;
+            }
+            if(!pool.reserve(log.frameSize(), log.frameType()) || !pool.acquire(frame))
+                frame = frame_handle(Mat(log.frameSize(), log.frameType()));
+            return log.frame(frame.mat());
+        }
+
+        capture_stamp stampFrame(uint64_t) const override { return stamp; }
+
+        size_t exhaustedCount() const override { return pool.exhaustedCount(); }
+
+    private:
+        frame_log_reader log;
+        capture_stamp stamp;
+        frame_pool pool;
+    };
+}
+
+bool parseCaptureBackend(const string &name, capture_backend &backend) {
+    if(name == "opencv") {
+        backend = CAPTURE_OPENCV;
+        return true;
+    }
+    if(name == "v4l2") {
+        backend = CAPTURE_V4L2;
+        return true;
+    }
+    if(name == "raw") {
+        backend = CAPTURE_RAW_FILE;
+        return true;
+    }
+    if(name == "log") {
+        backend = CAPTURE_FRAME_LOG;
+        return true;
+    }
+    return false;
+}
+
+bool parseCaptureFormat(const string &name, capture_format &format) {
+    if(name == "grey") {
+        format = CAPTURE_GREY;
+        return true;
+    }
+    if(name == "yuyv") {
+        format = CAPTURE_YUYV;
+        return true;
+    }
+    return false;
+}
+
+Ptr<capture_source> capture_source::open(const string &source, const capture_options &options) {
+    switch(options.backend) {
+        case CAPTURE_V4L2: {
+            Ptr<v4l2_source> v4l2 = makePtr<v4l2_source>(options);
+            if(!v4l2->open(isNumber(source) ? "/dev/video" + source : source))
+                return Ptr<capture_source>();
+            return v4l2;
+        }
+        case CAPTURE_RAW_FILE: {
+            Ptr<raw_file_source> file = makePtr<raw_file_source>(options);
+            if(!file->open(source))
+                return Ptr<capture_source>();
+            return file;
+        }
+        case CAPTURE_FRAME_LOG: {
+            Ptr<frame_log_source> log = makePtr<frame_log_source>(options);
+            if(!log->open(source))
+                return Ptr<capture_source>();
+            return log;
+        }
+        default: {
+            Ptr<opencv_source> video = makePtr<opencv_source>(options);
+            if(!video->open(source))
+                return Ptr<capture_source>();
+            return video;
+        }
+    }
+}
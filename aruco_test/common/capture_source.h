@@ -0,0 +1,96 @@
+//
+// Where frames come from: OpenCV's VideoCapture, V4L2 streaming buffers, a file of raw frames or a frame log.
+//
+
+#ifndef ARUCO_TEST_CAPTURE_SOURCE_H
+#define ARUCO_TEST_CAPTURE_SOURCE_H
+
+#include <opencv2/core.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "capture_stamp.h"
+#include "frame_pool.h"
+
+enum capture_backend {
+    CAPTURE_OPENCV,     // VideoCapture, BGR frames copied into a frame_pool
+    CAPTURE_V4L2,       // memory mapped V4L2 streaming buffers
+    CAPTURE_RAW_FILE,   // memory mapped file of raw frames back to back, like ffmpeg -f rawvideo writes
+    CAPTURE_FRAME_LOG   // frames and capture stamps recorded by a frame_log_writer
+};
+
+/**
+ * Pixel format of the V4L2 and raw file backends
+ */
+enum capture_format {
+    CAPTURE_GREY,       // 8 bit luma, handed to detection in place
+    CAPTURE_YUYV        // 4:2:2 interleaved, the luma is picked out into a pooled buffer
+};
+
+/**
+ * Parse "opencv", "v4l2", "raw" or "log" into a backend
+ *
+ * @return false if the name is not known
+ */
+bool parseCaptureBackend(const std::string &name, capture_backend &backend);
+
+/**
+ * Parse "grey" or "yuyv" into a pixel format
+ *
+ * @return false if the name is not known
+ */
+bool parseCaptureFormat(const std::string &name, capture_format &format);
+
+struct capture_options {
+    capture_backend backend = CAPTURE_OPENCV;
+    cv::Size frameSize = cv::Size(640, 480);    // V4L2 and raw file
+    capture_format format = CAPTURE_GREY;       // V4L2 and raw file
+    size_t bufferCount = 4;                     // frames the consumers may hold at once
+    frame_pages pages = FRAME_PAGES_NORMAL;
+};
+
+/**
+ * A stream of frames. grab waits for the next frame so it can be stamped before it is retrieved. The V4L2
+ * and raw file backends deliver single channel luma frames, which detection uses without a conversion;
+ * the frames of the GREY format are the driver's or the file's own memory. The source has to outlive every
+ * handle it gave out, and grab and retrieve belong to one thread.
+ */
+class capture_source {
+public:
+    virtual ~capture_source() {}
+
+    /**
+     * Open a source
+     *
+     * @param source camera id or video file for OpenCV, camera id or device for V4L2, file for raw files and
+     *               frame logs
+     * @return empty if the source can not be opened, the reason is printed
+     */
+    static cv::Ptr<capture_source> open(const std::string &source, const capture_options &options);
+
+    /** Wait for the next frame, false at the end of the stream */
+    virtual bool grab() = 0;
+
+    /**
+     * The grabbed frame
+     *
+     * @param frame replaced by the new frame
+     * @return false if there was no frame
+     */
+    virtual bool retrieve(frame_handle &frame) = 0;
+
+    /**
+     * Stamp the grabbed frame, call right after grab returned. Live sources take the time now, a frame log
+     * replays the stamp the frame was recorded with.
+     */
+    virtual capture_stamp stampFrame(uint64_t sequence) const { return stampCapture(sequence); }
+
+    /** Frames that had to wait for, or fall back from, a buffer because the consumers held every one */
+    virtual size_t exhaustedCount() const { return 0; }
+
+    /** Frames that did not fit the size of the buffers */
+    virtual size_t mismatchCount() const { return 0; }
+};
+
+
+#endif //ARUCO_TEST_CAPTURE_SOURCE_H
@@ -0,0 +1,43 @@
+//
+// Capture time and sequence number of a frame, taken right after the camera delivered it.
+//
+
+#ifndef ARUCO_TEST_CAPTURE_STAMP_H
+#define ARUCO_TEST_CAPTURE_STAMP_H
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * The monotonic time only compares against clocks of the same machine, consumers on another machine
+ * use the wall clock time, which is only as good as the clock synchronization between the two.
+ */
+struct capture_stamp {
+    uint64_t sequence = 0;      // counts every grabbed frame, gaps downstream are dropped frames
+    uint64_t monotonicUs = 0;   // steady clock, CLOCK_MONOTONIC on Linux
+    uint64_t wallUs = 0;        // system clock, microseconds since the epoch
+};
+
+inline uint64_t monotonicMicros() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline uint64_t wallMicros() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Stamp a frame, call right after grab() returned
+ */
+inline capture_stamp stampCapture(uint64_t sequence) {
+    capture_stamp stamp;
+    stamp.sequence = sequence;
+    stamp.monotonicUs = monotonicMicros();
+    stamp.wallUs = wallMicros();
+    return stamp;
+}
+
+
+#endif //ARUCO_TEST_CAPTURE_STAMP_H
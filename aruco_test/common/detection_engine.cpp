@@ -0,0 +1,85 @@
+#include "detection_engine.h"
+
+using namespace std;
+using namespace cv;
+
+detection_engine::detection_engine(const Ptr<aruco::Dictionary> &dictionary,
+                                   const Ptr<aruco::DetectorParameters> &params,
+                                   const detector_options &detectorOptions, const engine_options &options)
+        : frameOptions(detectorOptions), engineOptions(options) {
+    frameOptions.warmStart.maxIterations = options.warmIterations;
+
+    frameSetup.target = options.target;
+    frameSetup.dictionary = dictionary;
+    // the controller rewrites the parameters every frame, the cameras of one process share params
+    frameSetup.detectorParams = options.adaptParams ? makePtr<aruco::DetectorParameters>(*params) : params;
+    frameSetup.setMarkerLength(options.markerLength);
+    frameSetup.board = options.board;
+    frameSetup.charucoBoard = options.charucoBoard;
+    frameSetup.refindStrategy = options.refindStrategy;
+    frameSetup.collectRejected = options.collectRejected;
+    frameSetup.pyramid = makePtr<pyramid_detector>(frameOptions);
+    // index and decoder are chosen here for the dictionary, not on the first frame
+    frameSetup.pyramid->prepare(dictionary, *params);
+    if(options.trackPeriod > 0) {
+        frameSetup.tracker = makePtr<roi_tracker>(options.trackPeriod, options.trackPadding, frameOptions);
+        frameSetup.tracker->setFullScanDetector(frameSetup.pyramid);
+        frameSetup.tracker->prepare(dictionary, *params);
+    }
+    if(options.adaptParams)
+        frameSetup.adaptive = makePtr<parameter_controller>(*params, dictionary->markerSize, frameOptions.adaptive);
+    if(options.filterPoses)
+        frameSetup.poseFilter = makePtr<pose_filter>(frameOptions.filter);
+    if(options.warmIterations > 0)
+        frameSetup.warmStart = makePtr<warm_pose_solver>(frameOptions.warmStart);
+    if(options.squareSolver && options.target == TARGET_MARKERS)
+        frameSetup.squareSolver = makePtr<square_pose_solver>();
+}
+
+bool detection_engine::readCalibration(const string &filename) {
+    Mat camMatrix, distCoeffs;
+    Size imageSize;
+    bool fisheye;
+    if(!readCameraParameters(filename, camMatrix, distCoeffs, imageSize, fisheye))
+        return false;
+    setCalibration(camMatrix, distCoeffs, imageSize, fisheye);
+    return true;
+}
+
+void detection_engine::setCalibration(const Mat &camMatrix, const Mat &distCoeffs, const Size &imageSize,
+                                      bool fisheye) {
+    frameSetup.camMatrix = camMatrix;
+    frameSetup.distCoeffs = distCoeffs;
+    frameSetup.undistortMap.release();
+    if(frameSetup.canEstimatePose() && (engineOptions.undistortCell > 0 || fisheye))
+        frameSetup.useUndistortMap(fisheye, engineOptions.undistortCell, imageSize);
+}
+
+const frame_result &detection_engine::process(const Mat &frame, uint64_t captureUs, stage_latencies *latencies) {
+    processFrame(frameSetup, frame, result, latencies, captureUs);
+    flatStale = true;
+    return result;
+}
+
+const engine_results &detection_engine::results() {
+    if(flatStale) {
+        flatten();
+        flatStale = false;
+    }
+    return flat;
+}
+
+/**
+ * Copy the frame result into the flat arrays, assign and insert reuse their capacity
+ */
+void detection_engine::flatten() {
+    flat.ids.assign(result.ids.begin(), result.ids.end());
+    flat.corners.clear();
+    for(size_t i = 0; i < result.corners.size(); i++)
+        flat.corners.insert(flat.corners.end(), result.corners[i].begin(), result.corners[i].end());
+    flat.rvecs.assign(result.rvecs.begin(), result.rvecs.end());
+    flat.tvecs.assign(result.tvecs.begin(), result.tvecs.end());
+    flat.reprojectionErrors.assign(result.reprojectionErrors.begin(), result.reprojectionErrors.end());
+    flat.charucoIds.assign(result.charucoIds.begin(), result.charucoIds.end());
+    flat.charucoCorners.assign(result.charucoCorners.begin(), result.charucoCorners.end());
+}
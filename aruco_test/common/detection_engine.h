@@ -0,0 +1,115 @@
+//
+// Detection engine shared by the detectors and the replay benchmark.
+//
+
+#ifndef ARUCO_TEST_DETECTION_ENGINE_H
+#define ARUCO_TEST_DETECTION_ENGINE_H
+
+#include <opencv2/aruco.hpp>
+#include <opencv2/aruco/charuco.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "detection_stages.h"
+#include "detector_params.h"
+#include "latency_stats.h"
+
+/**
+ * What an engine detects and which of the optional steps it runs, the command line flags every
+ * detector shares
+ */
+struct engine_options {
+    pose_target target = TARGET_MARKERS;
+    float markerLength = 0;                          // TARGET_MARKERS
+    cv::Ptr<cv::aruco::Board> board;                 // both board targets
+    cv::Ptr<cv::aruco::CharucoBoard> charucoBoard;   // TARGET_CHARUCO_BOARD
+    bool refindStrategy = false;
+    bool collectRejected = false;
+    int trackPeriod = 0;                             // 0 scans every frame whole
+    float trackPadding = 0.5f;
+    bool filterPoses = false;
+    int warmIterations = 0;                          // 0 solves every pose from scratch
+    bool squareSolver = false;
+    int undistortCell = 0;                           // 0 only undistorts fisheye calibrations through a table
+    bool adaptParams = false;                        // narrow the detector parameters to the markers seen
+};
+
+/**
+ * Results of the last frame as flat arrays, one entry per marker or pose in each. The arrays keep their
+ * capacity, so once they have grown to the busiest frame filling them no longer allocates. They are only
+ * filled when asked for, the detectors read frameResult and never pay for the copy.
+ */
+struct engine_results {
+    std::vector< int > ids;
+    std::vector< cv::Point2f > corners;          // four per marker, in the order of ids
+    // one pose per marker for TARGET_MARKERS, at most one for a board
+    std::vector< cv::Vec3d > rvecs, tvecs;
+    std::vector< double > reprojectionErrors;
+    std::vector< int > charucoIds;
+    std::vector< cv::Point2f > charucoCorners;
+
+    size_t markerCount() const { return ids.size(); }
+    const cv::Point2f *markerCorners(size_t i) const { return &corners[4 * i]; }
+};
+
+/**
+ * Owns everything one camera's detection needs: the dictionary and detector parameters, the calibration,
+ * the stateful detectors, tracker, filter and solvers of the setup, and the buffers of the frame result.
+ * A detector builds one engine per camera and calls process on every frame. The steps themselves are the
+ * functions of detection_stages, which the pipeline and the benchmark still call one by one on setup().
+ */
+class detection_engine {
+public:
+    detection_engine(const cv::Ptr<cv::aruco::Dictionary> &dictionary,
+                     const cv::Ptr<cv::aruco::DetectorParameters> &params, const detector_options &detectorOptions,
+                     const engine_options &options);
+
+    /**
+     * Use a calibration file, see readCameraParameters
+     *
+     * @return false when the file can not be read, the engine keeps its calibration
+     */
+    bool readCalibration(const std::string &filename);
+
+    /**
+     * Use a calibration, builds the undistortion table when one is needed
+     *
+     * @param imageSize calibrated image size, empty when unknown
+     */
+    void setCalibration(const cv::Mat &camMatrix, const cv::Mat &distCoeffs, const cv::Size &imageSize, bool fisheye);
+
+    /** Id sent with every frame of this camera */
+    void setCameraId(int id) { frameSetup.cameraId = id; }
+
+    /**
+     * Detect, estimate and filter the poses of one frame
+     *
+     * @param captureUs monotonic capture time for the pose filter, 0 for now
+     * @param latencies if not null, receives the time of each step
+     * @return the results of the frame, see frameResult
+     */
+    const frame_result &process(const cv::Mat &frame, uint64_t captureUs = 0, stage_latencies *latencies = nullptr);
+
+    /** Results of the last frame as flat arrays, copied out of frameResult on the first call after process */
+    const engine_results &results();
+
+    /** Same results in the form of the aruco drawing functions and fillFrameMessage */
+    const frame_result &frameResult() const { return result; }
+
+    const detection_setup &setup() const { return frameSetup; }
+    const detector_options &detectorOptions() const { return frameOptions; }
+    const engine_options &options() const { return engineOptions; }
+
+private:
+    void flatten();
+
+    detector_options frameOptions;
+    engine_options engineOptions;
+    detection_setup frameSetup;
+    frame_result result;
+    engine_results flat;
+    bool flatStale = false;     // flat still holds an earlier frame
+};
+
+
+#endif //ARUCO_TEST_DETECTION_ENGINE_H
@@ -0,0 +1,330 @@
+#include "detection_stages.h"
+
+#include <algorithm>
+#include <opencv2/calib3d.hpp>
+#include <opencv2/imgproc.hpp>
+#include "capture_stamp.h"
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    /**
+     * RMS distance between image points and the object points projected with the pose
+     */
+    double reprojectionError(const Mat &camMatrix, const Mat &distCoeffs, const vector< Point3f > &objectPoints,
+                             const vector< Point2f > &imagePoints, const Vec3d &rvec, const Vec3d &tvec,
+                             vector< Point2f > &projected) {
+        if(objectPoints.empty())
+            return 0;
+        projectPoints(objectPoints, rvec, tvec, camMatrix, distCoeffs, projected);
+        double sum = 0;
+        for(size_t i = 0; i < projected.size(); i++) {
+            Point2f d = projected[i] - imagePoints[i];
+            sum += d.x * d.x + d.y * d.y;
+        }
+        return sqrt(sum / projected.size());
+    }
+
+    /**
+     * Object points into the distorted frame, fisheye calibrations through their undistort map
+     */
+    void projectToFrame(const detection_setup &setup, const vector< Point3f > &objectPoints, const Vec3d &rvec,
+                        const Vec3d &tvec, vector< Point2f > &imagePoints) {
+        if(setup.undistortMap)
+            setup.undistortMap->project(objectPoints, rvec, tvec, imagePoints);
+        else
+            projectPoints(objectPoints, rvec, tvec, setup.camMatrix, setup.distCoeffs, imagePoints);
+    }
+
+    /**
+     * Distortion for the aruco calls that only know the pinhole model, fisheye coefficients would be read
+     * as pinhole ones so those calls get none
+     */
+    const Mat &pinholeDistortion(const detection_setup &setup) {
+        static const Mat noDistortion;
+        if(setup.undistortMap && setup.undistortMap->isFisheye())
+            return noDistortion;
+        return setup.distCoeffs;
+    }
+
+    void addPose(frame_result &result, const Vec3d &rvec, const Vec3d &tvec, double error) {
+        result.rvecs.push_back(rvec);
+        result.tvecs.push_back(tvec);
+        result.reprojectionErrors.push_back(error);
+    }
+
+    /**
+     * Next entry of the predicted corners, the entries past the ids keep their capacity between frames
+     */
+    vector< Point2f > &nextPrediction(frame_result &result, int id) {
+        result.predictedIds.push_back(id);
+        if(result.predictedCorners.size() < result.predictedIds.size())
+            result.predictedCorners.resize(result.predictedIds.size());
+        return result.predictedCorners[result.predictedIds.size() - 1];
+    }
+
+    /**
+     * Project the markers of the tracked poses to where the filter expects them in the next frame, into
+     * predictedIds and predictedCorners
+     */
+    void predictMarkerCorners(const detection_setup &setup, frame_result &result) {
+        result.predictedIds.clear();
+        uint64_t nextUs = setup.poseFilter->nextFrameUs();
+        Vec3d rvec, tvec;
+        if(setup.target == TARGET_MARKERS) {
+            for(size_t i = 0; i < result.tracks.size(); i++) {
+                // lost markers are not tracked, the next full scan finds them
+                if(!result.tracks[i].measured ||
+                   !setup.poseFilter->predict(result.tracks[i].id, nextUs, rvec, tvec))
+                    continue;
+                projectToFrame(setup, setup.markerObjectPoints, rvec, tvec,
+                               nextPrediction(result, result.tracks[i].id));
+            }
+            return;
+        }
+
+        // the whole board moves together, only its markers that the tracker follows need a region
+        if(!setup.poseFilter->predict(-1, nextUs, rvec, tvec))
+            return;
+        const vector< int > &boardIds = setup.board->ids;
+        for(size_t i = 0; i < result.ids.size(); i++) {
+            size_t b = find(boardIds.begin(), boardIds.end(), result.ids[i]) - boardIds.begin();
+            if(b == boardIds.size())
+                continue;
+            projectToFrame(setup, setup.board->objPoints[b], rvec, tvec, nextPrediction(result, result.ids[i]));
+        }
+    }
+}
+
+bool detection_setup::canEstimatePose() const {
+    if(camMatrix.total() == 0)
+        return false;
+    return target != TARGET_MARKERS || markerLength > 0;
+}
+
+void detection_setup::setMarkerLength(float length) {
+    // in the order estimatePoseSingleMarkers uses
+    markerLength = length;
+    float half = length / 2.f;
+    markerObjectPoints.clear();
+    markerObjectPoints.push_back(Point3f(-half, half, 0));
+    markerObjectPoints.push_back(Point3f(half, half, 0));
+    markerObjectPoints.push_back(Point3f(half, -half, 0));
+    markerObjectPoints.push_back(Point3f(-half, -half, 0));
+}
+
+void detection_setup::useUndistortMap(bool fisheye, int cellSize, const Size &imageSize) {
+    undistortMap = makePtr<undistort_map>(camMatrix, distCoeffs, fisheye,
+                                          cellSize > 0 ? cellSize : undistort_map::defaultCellSize);
+    if(imageSize.area() > 0)
+        undistortMap->prepare(imageSize);
+}
+
+void frame_result::clear() {
+    ids.clear();
+    corners.clear();
+    rejected.clear();
+    charucoIds.clear();
+    charucoCorners.clear();
+    rvecs.clear();
+    tvecs.clear();
+    reprojectionErrors.clear();
+    idealCorners.clear();
+    idealCharucoCorners.clear();
+    squarePoses.clear();
+    tracks.clear();
+}
+
+void convertFrame(const Mat &image, frame_result &result) {
+    if(image.channels() == 3) {
+        cvtColor(image, result.greyBuffer, COLOR_BGR2GRAY);
+        result.grey = result.greyBuffer;
+    } else {
+        result.grey = image;
+    }
+}
+
+void detectFrameMarkers(const detection_setup &setup, const Mat &image, frame_result &result, uint64_t captureUs) {
+    bool collectRejected = setup.collectRejected || (setup.refindStrategy && setup.target != TARGET_MARKERS);
+    vector< vector< Point2f > > *rejected = collectRejected ? &result.rejected : nullptr;
+    if(!collectRejected)
+        result.rejected.clear();
+
+    if(setup.adaptive)
+        setup.adaptive->apply(*setup.detectorParams);
+    if(setup.tracker)
+        setup.tracker->detect(image, setup.dictionary, setup.detectorParams, result.corners, result.ids, rejected,
+                              captureUs);
+    else
+        setup.pyramid->detect(image, setup.dictionary, setup.detectorParams, result.corners, result.ids, rejected);
+    if(setup.adaptive)
+        setup.adaptive->observe(image, result.corners);
+}
+
+void refineFrameMarkers(const detection_setup &setup, const Mat &image, frame_result &result) {
+    if(!setup.refindStrategy || setup.target == TARGET_MARKERS)
+        return;
+    aruco::refineDetectedMarkers(image, setup.board, result.corners, result.ids, result.rejected,
+                                 setup.camMatrix, pinholeDistortion(setup));
+}
+
+int interpolateFrameCharuco(const detection_setup &setup, const Mat &image, frame_result &result) {
+    result.charucoCorners.clear();
+    result.charucoIds.clear();
+    if(setup.target != TARGET_CHARUCO_BOARD || result.ids.empty())
+        return 0;
+    return aruco::interpolateCornersCharuco(result.corners, result.ids, image, setup.charucoBoard,
+                                            result.charucoCorners, result.charucoIds,
+                                            setup.camMatrix, pinholeDistortion(setup));
+}
+
+void estimateFramePose(const detection_setup &setup, frame_result &result) {
+    result.rvecs.clear();
+    result.tvecs.clear();
+    result.reprojectionErrors.clear();
+    result.squarePoses.clear();
+    if(!setup.canEstimatePose())
+        return;
+
+    // with an undistort map the corners are undistorted once here and every solver sees a pinhole camera
+    static const Mat noDistortion;
+    const Mat &camMatrix = setup.camMatrix;
+    const Mat &distCoeffs = setup.undistortMap ? noDistortion : setup.distCoeffs;
+    const vector< vector< Point2f > > &corners = setup.undistortMap ? result.idealCorners : result.corners;
+    const vector< Point2f > &charucoCorners =
+            setup.undistortMap ? result.idealCharucoCorners : result.charucoCorners;
+    if(setup.undistortMap) {
+        setup.undistortMap->prepare(result.grey.size());
+        setup.undistortMap->undistort(result.corners, result.idealCorners);
+        setup.undistortMap->undistort(result.charucoCorners, result.idealCharucoCorners);
+    }
+
+    warm_pose_solver *warm = setup.warmStart.get();
+    if(warm != nullptr)
+        warm->nextFrame();
+
+    Vec3d rvec, tvec;
+    double error;
+    const vector< Point3f > &markerPoints = setup.markerObjectPoints;
+    vector< Point3f > &objectPoints = result.objectPoints;
+    vector< Point2f > &imagePoints = result.imagePoints;
+    switch(setup.target) {
+        case TARGET_MARKERS:
+            if(result.ids.empty())
+                break;
+            if(setup.squareSolver) {
+                setup.squareSolver->solve(corners, setup.markerLength, camMatrix, distCoeffs, result.squarePoses);
+            } else if(warm == nullptr) {
+                aruco::estimatePoseSingleMarkers(corners, setup.markerLength, camMatrix, distCoeffs,
+                                                 result.rvecs, result.tvecs);
+                for(size_t i = 0; i < result.rvecs.size(); i++)
+                    result.reprojectionErrors.push_back(reprojectionError(camMatrix, distCoeffs, markerPoints,
+                                                                          corners[i], result.rvecs[i],
+                                                                          result.tvecs[i], result.projectedPoints));
+                break;
+            }
+            for(size_t i = 0; i < result.ids.size(); i++) {
+                if(warm != nullptr && warm->solve(result.ids[i], markerPoints, corners[i], camMatrix, distCoeffs,
+                                                  rvec, tvec, error)) {
+                    addPose(result, rvec, tvec, error);
+                    continue;
+                }
+                if(setup.squareSolver && result.squarePoses[i].valid) {
+                    rvec = result.squarePoses[i].rvecs[0];
+                    tvec = result.squarePoses[i].tvecs[0];
+                    error = result.squarePoses[i].errors[0];
+                } else {
+                    // the cold solve estimatePoseSingleMarkers runs for each marker
+                    solvePnP(markerPoints, corners[i], camMatrix, distCoeffs, rvec, tvec);
+                    error = reprojectionError(camMatrix, distCoeffs, markerPoints, corners[i], rvec, tvec,
+                                              result.projectedPoints);
+                }
+                if(warm != nullptr)
+                    warm->remember(result.ids[i], rvec, tvec, error);
+                addPose(result, rvec, tvec, error);
+            }
+            break;
+        case TARGET_GRID_BOARD:
+            if(result.ids.empty())
+                break;
+            aruco::getBoardObjectAndImagePoints(setup.board, corners, result.ids, objectPoints, imagePoints);
+            if(warm != nullptr && warm->solve(-1, objectPoints, imagePoints, camMatrix, distCoeffs,
+                                              rvec, tvec, error)) {
+                addPose(result, rvec, tvec, error);
+            } else if(aruco::estimatePoseBoard(corners, result.ids, setup.board, camMatrix, distCoeffs,
+                                               rvec, tvec) > 0) {
+                error = reprojectionError(camMatrix, distCoeffs, objectPoints, imagePoints, rvec, tvec,
+                                          result.projectedPoints);
+                addPose(result, rvec, tvec, error);
+                if(warm != nullptr)
+                    warm->remember(-1, rvec, tvec, error);
+            }
+            break;
+        case TARGET_CHARUCO_BOARD:
+            objectPoints.clear();
+            for(size_t i = 0; i < result.charucoIds.size(); i++)
+                objectPoints.push_back(setup.charucoBoard->chessboardCorners[result.charucoIds[i]]);
+            if(warm != nullptr && warm->solve(-1, objectPoints, charucoCorners, camMatrix, distCoeffs,
+                                              rvec, tvec, error)) {
+                addPose(result, rvec, tvec, error);
+            } else if(aruco::estimatePoseCharucoBoard(charucoCorners, result.charucoIds, setup.charucoBoard,
+                                                      camMatrix, distCoeffs, rvec, tvec)) {
+                error = reprojectionError(camMatrix, distCoeffs, objectPoints, charucoCorners, rvec, tvec,
+                                          result.projectedPoints);
+                addPose(result, rvec, tvec, error);
+                if(warm != nullptr)
+                    warm->remember(-1, rvec, tvec, error);
+            }
+            break;
+    }
+}
+
+void filterFramePoses(const detection_setup &setup, uint64_t captureUs, frame_result &result) {
+    result.tracks.clear();
+    if(!setup.poseFilter)
+        return;
+    if(captureUs == 0)
+        captureUs = monotonicMicros();
+
+    // a board has at most one pose, tracked as id -1
+    static const vector< int > boardIds(1, -1);
+    const vector< int > &ids = setup.target == TARGET_MARKERS ? result.ids : boardIds;
+    setup.poseFilter->update(captureUs, ids, result.rvecs, result.tvecs, result.tracks);
+
+    if(!setup.tracker || !setup.canEstimatePose())
+        return;
+    predictMarkerCorners(setup, result);
+    setup.tracker->setPredictedCorners(result.predictedIds, result.predictedCorners, captureUs);
+}
+
+void processFrame(const detection_setup &setup, const Mat &image, frame_result &result,
+                  stage_latencies *latencies, uint64_t captureUs) {
+    // one stamp for the tracker and the filter, so the tracker can tell which frame a prediction is from
+    if(captureUs == 0)
+        captureUs = monotonicMicros();
+    {
+        stage_timer timer(latencies, STAGE_CONVERT);
+        convertFrame(image, result);
+    }
+    {
+        stage_timer timer(latencies, STAGE_DETECT);
+        detectFrameMarkers(setup, result.grey, result, captureUs);
+    }
+    if(setup.refindStrategy && setup.target != TARGET_MARKERS) {
+        stage_timer timer(latencies, STAGE_REFINE);
+        refineFrameMarkers(setup, result.grey, result);
+    }
+    if(setup.target == TARGET_CHARUCO_BOARD) {
+        stage_timer timer(latencies, STAGE_INTERPOLATE);
+        interpolateFrameCharuco(setup, result.grey, result);
+    }
+    {
+        stage_timer timer(latencies, STAGE_POSE);
+        estimateFramePose(setup, result);
+    }
+    if(setup.poseFilter) {
+        stage_timer timer(latencies, STAGE_FILTER);
+        filterFramePoses(setup, captureUs, result);
+    }
+}
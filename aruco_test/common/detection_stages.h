@@ -0,0 +1,154 @@
+//
+// Detection and pose steps of the three detectors, shared with the replay benchmark.
+//
+
+#ifndef ARUCO_TEST_DETECTION_STAGES_H
+#define ARUCO_TEST_DETECTION_STAGES_H
+
+#include <opencv2/aruco.hpp>
+#include <opencv2/aruco/charuco.hpp>
+#include <vector>
+#include "latency_stats.h"
+#include "parameter_controller.h"
+#include "pose_filter.h"
+#include "pyramid_detector.h"
+#include "roi_tracker.h"
+#include "square_pose.h"
+#include "undistort_map.h"
+#include "warm_pose.h"
+
+/**
+ * What the pose is estimated for
+ */
+enum pose_target {
+    TARGET_MARKERS,         // every marker on its own, detect_single
+    TARGET_GRID_BOARD,      // one pose for an aruco grid board, detect_board
+    TARGET_CHARUCO_BOARD    // one pose from the interpolated chessboard corners, detect_board_charuco
+};
+
+/**
+ * Everything the steps need, read only while frames are processed. The cameras of one process each have
+ * their own setup, sharing the dictionary and detector parameters but not the stateful pyramid, tracker,
+ * filter, warm start, solver buffers and undistortion table.
+ */
+struct detection_setup {
+    pose_target target = TARGET_MARKERS;
+    cv::Ptr<cv::aruco::Dictionary> dictionary;
+    cv::Ptr<cv::aruco::DetectorParameters> detectorParams;
+    cv::Mat camMatrix, distCoeffs;
+    float markerLength = 0;                          // TARGET_MARKERS, set with setMarkerLength
+    std::vector< cv::Point3f > markerObjectPoints;   // corners of a marker of markerLength in its own frame
+    cv::Ptr<cv::aruco::Board> board;                 // both board targets
+    cv::Ptr<cv::aruco::CharucoBoard> charucoBoard;   // TARGET_CHARUCO_BOARD
+    bool refindStrategy = false;
+    bool collectRejected = false;
+    cv::Ptr<pyramid_detector> pyramid;
+    cv::Ptr<roi_tracker> tracker;                    // empty when tracking is off
+    cv::Ptr<parameter_controller> adaptive;          // empty when detectorParams stay as configured
+    cv::Ptr<pose_filter> poseFilter;                 // empty when poses are sent unfiltered
+    cv::Ptr<warm_pose_solver> warmStart;             // empty when every pose is solved from scratch
+    cv::Ptr<square_pose_solver> squareSolver;        // TARGET_MARKERS, empty for estimatePoseSingleMarkers
+    cv::Ptr<undistort_map> undistortMap;             // empty when the pose solvers undistort the corners
+    int cameraId = 0;                                // sent with every frame of a multi-camera detector
+
+    /** Pose needs intrinsics, and a marker length for single markers */
+    bool canEstimatePose() const;
+
+    /** Marker length of TARGET_MARKERS and the object points of its corners */
+    void setMarkerLength(float length);
+
+    /**
+     * Undistort the corners through a lookup table of camMatrix and distCoeffs before solving poses.
+     * Fisheye calibrations need it, the pose solvers only know the pinhole model.
+     *
+     * @param cellSize node spacing of the table in pixels, 0 for the default
+     * @param imageSize calibrated image size to build the table for now, empty builds it on the first frame
+     */
+    void useUndistortMap(bool fisheye, int cellSize, const cv::Size &imageSize);
+};
+
+/**
+ * Results of one frame, the vectors keep their capacity when the result is reused
+ */
+struct frame_result {
+    cv::Mat grey;   // what the steps detect on, the frame itself when it already is grey
+    std::vector< int > ids;
+    std::vector< std::vector< cv::Point2f > > corners, rejected;
+    std::vector< int > charucoIds;
+    std::vector< cv::Point2f > charucoCorners;
+    // one entry per marker for TARGET_MARKERS, a single entry for a board with a valid pose
+    std::vector< cv::Vec3d > rvecs, tvecs;
+    // RMS reprojection error in pixels of each pose
+    std::vector< double > reprojectionErrors;
+    // corners and charucoCorners with the lens distortion removed, what the poses were solved on when
+    // the setup has an undistort map
+    std::vector< std::vector< cv::Point2f > > idealCorners;
+    std::vector< cv::Point2f > idealCharucoCorners;
+    // both solutions of every marker when the square solver ran, one entry per marker
+    std::vector< square_pose > squarePoses;
+    // filtered pose of every live track when a pose filter is set, the measured ids first
+    std::vector< tracked_pose > tracks;
+
+    cv::Mat greyBuffer; // owns the converted copy, grey may alias a frame someone else still holds
+
+    // scratch buffers of the pose and filter steps, kept with the result so a warm engine does not allocate
+    std::vector< cv::Point3f > objectPoints;
+    std::vector< cv::Point2f > imagePoints, projectedPoints;
+    std::vector< int > predictedIds;
+    std::vector< std::vector< cv::Point2f > > predictedCorners;   // may hold more entries than predictedIds
+
+    void clear();
+};
+
+/**
+ * Convert the frame to grey once, so the detector, refinement and interpolation do not each convert it
+ */
+void convertFrame(const cv::Mat &image, frame_result &result);
+
+/**
+ * Find the markers, with the tracker when it is set and the pyramid detector otherwise. Rejected
+ * candidates are only collected when the refind strategy or drawing needs them. With a parameter
+ * controller the detector parameters are narrowed to the markers of the last frames first.
+ *
+ * @param captureUs capture time of the frame, the same the pose filter gets, so the tracker only uses
+ *                  predictions made from the frame before
+ */
+void detectFrameMarkers(const detection_setup &setup, const cv::Mat &image, frame_result &result,
+                        uint64_t captureUs = 0);
+
+/**
+ * Refind strategy, look for the board's missing markers among the rejected candidates. Does nothing
+ * unless it is enabled for a board target.
+ */
+void refineFrameMarkers(const detection_setup &setup, const cv::Mat &image, frame_result &result);
+
+/**
+ * Interpolate the chessboard corners from the markers, TARGET_CHARUCO_BOARD only
+ *
+ * @return number of interpolated corners
+ */
+int interpolateFrameCharuco(const detection_setup &setup, const cv::Mat &image, frame_result &result);
+
+/**
+ * Estimate the pose of every marker or of the board into rvecs and tvecs, with the reprojection error
+ * of each pose. With a warm start the poses are refined from the previous frame's, falling back to the
+ * cold solvers when there is none or the error jumps.
+ */
+void estimateFramePose(const detection_setup &setup, frame_result &result);
+
+/**
+ * Step the pose filter with the frame's poses into tracks, and hand the tracker where the markers will be
+ * in the next frame. Does nothing without a pose filter.
+ *
+ * @param captureUs monotonic capture time of the frame, now when 0
+ */
+void filterFramePoses(const detection_setup &setup, uint64_t captureUs, frame_result &result);
+
+/**
+ * Run every step on one frame, timing each into latencies unless it is null
+ */
+void processFrame(const detection_setup &setup, const cv::Mat &image, frame_result &result,
+                  stage_latencies *latencies = nullptr, uint64_t captureUs = 0);
+
+
+#endif //ARUCO_TEST_DETECTION_STAGES_H
@@ -0,0 +1,131 @@
+#include "detector_params.h"
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    void readOptional(const FileStorage &fs, const char *key, double &value) {
+        if(!fs[key].empty())
+            fs[key] >> value;
+    }
+
+    void readOptional(const FileStorage &fs, const char *key, int &value) {
+        if(!fs[key].empty())
+            fs[key] >> value;
+    }
+}
+
+/**
+ */
+bool readCameraParameters(string filename, Mat &camMatrix, Mat &distCoeffs, Size &imageSize, bool &fisheye) {
+    FileStorage fs(filename, FileStorage::READ);
+    if(!fs.isOpened())
+        return false;
+    fs["camera_matrix"] >> camMatrix;
+    fs["distortion_coefficients"] >> distCoeffs;
+    imageSize = Size();
+    if(!fs["image_width"].empty() && !fs["image_height"].empty())
+        imageSize = Size((int)fs["image_width"], (int)fs["image_height"]);
+    fisheye = !fs["fisheye_model"].empty() && (int)fs["fisheye_model"] != 0;
+    return true;
+}
+
+/**
+ */
+bool readDetectorParameters(string filename, Ptr<aruco::DetectorParameters> &params, detector_options &options) {
+    FileStorage fs(filename, FileStorage::READ);
+    if(!fs.isOpened())
+        return false;
+    fs["adaptiveThreshWinSizeMin"] >> params->adaptiveThreshWinSizeMin;
+    fs["adaptiveThreshWinSizeMax"] >> params->adaptiveThreshWinSizeMax;
+    fs["adaptiveThreshWinSizeStep"] >> params->adaptiveThreshWinSizeStep;
+    fs["adaptiveThreshConstant"] >> params->adaptiveThreshConstant;
+    fs["minMarkerPerimeterRate"] >> params->minMarkerPerimeterRate;
+    fs["maxMarkerPerimeterRate"] >> params->maxMarkerPerimeterRate;
+    fs["polygonalApproxAccuracyRate"] >> params->polygonalApproxAccuracyRate;
+    fs["minCornerDistanceRate"] >> params->minCornerDistanceRate;
+    fs["minDistanceToBorder"] >> params->minDistanceToBorder;
+    fs["minMarkerDistanceRate"] >> params->minMarkerDistanceRate;
+    fs["cornerRefinementMethod"] >> params->cornerRefinementMethod;
+    fs["cornerRefinementWinSize"] >> params->cornerRefinementWinSize;
+    fs["cornerRefinementMaxIterations"] >> params->cornerRefinementMaxIterations;
+    fs["cornerRefinementMinAccuracy"] >> params->cornerRefinementMinAccuracy;
+    fs["markerBorderBits"] >> params->markerBorderBits;
+    fs["perspectiveRemovePixelPerCell"] >> params->perspectiveRemovePixelPerCell;
+    fs["perspectiveRemoveIgnoredMarginPerCell"] >> params->perspectiveRemoveIgnoredMarginPerCell;
+    fs["maxErroneousBitsInBorderRate"] >> params->maxErroneousBitsInBorderRate;
+    fs["minOtsuStdDev"] >> params->minOtsuStdDev;
+    fs["errorCorrectionRate"] >> params->errorCorrectionRate;
+
+    // a missing key would read as 0, so only override what is in the file
+    if(!fs["decimation"].empty())
+        fs["decimation"] >> options.decimation;
+    if(!fs["integralThreshold"].empty())
+        options.integralThreshold = (int)fs["integralThreshold"] != 0;
+    readOptional(fs, "filterTranslationAcceleration", options.filter.translationAcceleration);
+    readOptional(fs, "filterRotationAcceleration", options.filter.rotationAcceleration);
+    readOptional(fs, "filterTranslationMeasurement", options.filter.translationMeasurement);
+    readOptional(fs, "filterRotationMeasurement", options.filter.rotationMeasurement);
+    readOptional(fs, "filterTranslationVelocity", options.filter.translationVelocity);
+    readOptional(fs, "filterRotationVelocity", options.filter.rotationVelocity);
+    readOptional(fs, "filterGate", options.filter.gate);
+    readOptional(fs, "filterCoastSeconds", options.filter.coastSeconds);
+    readOptional(fs, "warmStartJumpRate", options.warmStart.jumpRate);
+    readOptional(fs, "warmStartJumpPixels", options.warmStart.jumpPixels);
+    readOptional(fs, "adaptiveHistoryFrames", options.adaptive.historyFrames);
+    readOptional(fs, "adaptivePerimeterMargin", options.adaptive.perimeterMargin);
+    readOptional(fs, "adaptiveProbePeriod", options.adaptive.probePeriod);
+    readOptional(fs, "adaptiveMinPixelPerCell", options.adaptive.minPixelPerCell);
+    readOptional(fs, "adaptiveHighContrast", options.adaptive.highContrast);
+    if(options.decimation != 1 && options.decimation != 2 && options.decimation != 4)
+        return false;
+    return true;
+}
+
+/**
+ */
+bool writeDetectorParameters(string filename, const aruco::DetectorParameters &params,
+                             const detector_options &options) {
+    FileStorage fs(filename, FileStorage::WRITE);
+    if(!fs.isOpened())
+        return false;
+    fs << "adaptiveThreshWinSizeMin" << params.adaptiveThreshWinSizeMin;
+    fs << "adaptiveThreshWinSizeMax" << params.adaptiveThreshWinSizeMax;
+    fs << "adaptiveThreshWinSizeStep" << params.adaptiveThreshWinSizeStep;
+    fs << "adaptiveThreshConstant" << params.adaptiveThreshConstant;
+    fs << "minMarkerPerimeterRate" << params.minMarkerPerimeterRate;
+    fs << "maxMarkerPerimeterRate" << params.maxMarkerPerimeterRate;
+    fs << "polygonalApproxAccuracyRate" << params.polygonalApproxAccuracyRate;
+    fs << "minCornerDistanceRate" << params.minCornerDistanceRate;
+    fs << "minDistanceToBorder" << params.minDistanceToBorder;
+    fs << "minMarkerDistanceRate" << params.minMarkerDistanceRate;
+    fs << "cornerRefinementMethod" << params.cornerRefinementMethod;
+    fs << "cornerRefinementWinSize" << params.cornerRefinementWinSize;
+    fs << "cornerRefinementMaxIterations" << params.cornerRefinementMaxIterations;
+    fs << "cornerRefinementMinAccuracy" << params.cornerRefinementMinAccuracy;
+    fs << "markerBorderBits" << params.markerBorderBits;
+    fs << "perspectiveRemovePixelPerCell" << params.perspectiveRemovePixelPerCell;
+    fs << "perspectiveRemoveIgnoredMarginPerCell" << params.perspectiveRemoveIgnoredMarginPerCell;
+    fs << "maxErroneousBitsInBorderRate" << params.maxErroneousBitsInBorderRate;
+    fs << "minOtsuStdDev" << params.minOtsuStdDev;
+    fs << "errorCorrectionRate" << params.errorCorrectionRate;
+
+    fs << "decimation" << options.decimation;
+    fs << "integralThreshold" << (options.integralThreshold ? 1 : 0);
+    fs << "filterTranslationAcceleration" << options.filter.translationAcceleration;
+    fs << "filterRotationAcceleration" << options.filter.rotationAcceleration;
+    fs << "filterTranslationMeasurement" << options.filter.translationMeasurement;
+    fs << "filterRotationMeasurement" << options.filter.rotationMeasurement;
+    fs << "filterTranslationVelocity" << options.filter.translationVelocity;
+    fs << "filterRotationVelocity" << options.filter.rotationVelocity;
+    fs << "filterGate" << options.filter.gate;
+    fs << "filterCoastSeconds" << options.filter.coastSeconds;
+    fs << "warmStartJumpRate" << options.warmStart.jumpRate;
+    fs << "warmStartJumpPixels" << options.warmStart.jumpPixels;
+    fs << "adaptiveHistoryFrames" << options.adaptive.historyFrames;
+    fs << "adaptivePerimeterMargin" << options.adaptive.perimeterMargin;
+    fs << "adaptiveProbePeriod" << options.adaptive.probePeriod;
+    fs << "adaptiveMinPixelPerCell" << options.adaptive.minPixelPerCell;
+    fs << "adaptiveHighContrast" << options.adaptive.highContrast;
+    return true;
+}
@@ -0,0 +1,52 @@
+//
+// Camera calibration and detector parameter files, shared by all detectors.
+//
+
+#ifndef ARUCO_TEST_DETECTOR_PARAMS_H
+#define ARUCO_TEST_DETECTOR_PARAMS_H
+
+#include <opencv2/aruco.hpp>
+#include <string>
+#include "parameter_controller.h"
+#include "pose_filter.h"
+#include "warm_pose.h"
+
+/**
+ * Detection settings that aruco::DetectorParameters has no field for, read from the same file
+ */
+struct detector_options {
+    // find candidates on a frame downscaled by this factor (1, 2 or 4), corners are refined at full resolution
+    int decimation = 1;
+    // threshold the whole window sweep from one integral image instead of adaptiveThreshold per window
+    bool integralThreshold = false;
+    // noise model of the pose filter, keys filterTranslationAcceleration, filterRotationMeasurement, ...
+    pose_filter_options filter;
+    // when a warm started pose counts as jumped, keys warmStartJumpRate and warmStartJumpPixels
+    warm_start_options warmStart;
+    // how the detection ranges follow the markers, keys adaptiveHistoryFrames, adaptivePerimeterMargin, ...
+    adaptive_options adaptive;
+};
+
+/**
+ * Read camera_matrix and distortion_coefficients from a calibration file, with the image size the camera
+ * was calibrated at, empty when the file has none, and whether the calibration used the fisheye model
+ */
+bool readCameraParameters(std::string filename, cv::Mat &camMatrix, cv::Mat &distCoeffs, cv::Size &imageSize,
+                          bool &fisheye);
+
+/**
+ * Read a detector parameter file, keys our options have are optional and keep their defaults
+ */
+bool readDetectorParameters(std::string filename, cv::Ptr<cv::aruco::DetectorParameters> &params,
+                            detector_options &options);
+
+/**
+ * Write every key readDetectorParameters reads
+ *
+ * @return false if the file can not be written
+ */
+bool writeDetectorParameters(std::string filename, const cv::aruco::DetectorParameters &params,
+                             const detector_options &options);
+
+
+#endif //ARUCO_TEST_DETECTOR_PARAMS_H
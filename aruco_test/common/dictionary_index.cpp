@@ -0,0 +1,158 @@
+#include "dictionary_index.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    int popcount(uint64_t value) {
+        return __builtin_popcountll(value);
+    }
+}
+
+dictionary_index::dictionary_index(const Ptr<aruco::Dictionary> &dictionary)
+        : dictionary(dictionary), markerCount(dictionary->bytesList.rows), tolerance(-1) {
+    CV_Assert(supports(*dictionary));
+
+    // bytesList rows hold the bytes of rotation 0, then those of rotation 1, ...
+    int nbytes = dictionary->bytesList.cols;
+    codes.resize((size_t)markerCount * 4);
+    exact.reserve(codes.size());
+    for(int id = 0; id < markerCount; id++) {
+        const uchar *bytes = dictionary->bytesList.ptr(id);
+        for(int r = 0; r < 4; r++) {
+            uint64_t code = 0;
+            for(int b = 0; b < nbytes; b++)
+                code |= (uint64_t)bytes[r * nbytes + b] << (8 * b);
+            codes[id * 4 + r] = code;
+            exact.insert(make_pair(code, (uint32_t)(id * 4 + r)));
+        }
+    }
+
+    // an exact match is only the answer when no lower id is within the tolerance too, which the
+    // predefined dictionaries guarantee up to maxCorrectionBits but custom ones may not
+    lowerDistances.assign(codes.size(), dictionary->markerSize * dictionary->markerSize + 1);
+    for(size_t e = 4; e < codes.size(); e++) {
+        int nearest = lowerDistances[e];
+        size_t lowerEnd = e - e % 4;
+        for(size_t o = 0; o < lowerEnd; o++)
+            nearest = min(nearest, popcount(codes[e] ^ codes[o]));
+        lowerDistances[e] = nearest;
+    }
+}
+
+bool dictionary_index::supports(const aruco::Dictionary &dictionary) {
+    return dictionary.markerSize * dictionary.markerSize <= 64;
+}
+
+void dictionary_index::prepare(int maxCorrection) {
+    maxCorrection = max(0, maxCorrection);
+    if(maxCorrection == tolerance)
+        return;
+    tolerance = maxCorrection;
+
+    // maxCorrection + 1 chunks of near equal width. A tolerance of every bit matches anything, the
+    // tables would not narrow anything down and identify scans the codes instead
+    int bits = dictionary->markerSize * dictionary->markerSize;
+    int count = maxCorrection < bits ? maxCorrection + 1 : 0;
+    chunkStarts.assign(count + 1, 0);
+    for(int c = 1; c <= count; c++)
+        chunkStarts[c] = c * bits / count;
+
+    chunks.assign(count, vector< pair< uint64_t, uint32_t > >());
+    for(size_t c = 0; c < chunks.size(); c++) {
+        chunks[c].reserve(codes.size());
+        for(size_t e = 0; e < codes.size(); e++)
+            chunks[c].push_back(make_pair(chunkOf(codes[e], c), (uint32_t)e));
+        sort(chunks[c].begin(), chunks[c].end());
+    }
+}
+
+/**
+ * Bits chunkStarts[chunk] up to chunkStarts[chunk + 1] of a code, codes only use their low markerSize^2 bits
+ */
+uint64_t dictionary_index::chunkOf(uint64_t code, size_t chunk) const {
+    int start = chunkStarts[chunk], width = chunkStarts[chunk + 1] - start;
+    uint64_t mask = width >= 64 ? ~(uint64_t)0 : (((uint64_t)1 << width) - 1);
+    return (code >> start) & mask;
+}
+
+/**
+ * Rotation of a marker with the fewest errors, -1 when even that one is out of tolerance
+ */
+int dictionary_index::bestRotation(int candidate, uint64_t code) const {
+    int best = tolerance + 1, rotation = -1;
+    for(int r = 0; r < 4; r++) {
+        int distance = popcount(codes[candidate * 4 + r] ^ code);
+        if(distance < best) {
+            best = distance;
+            rotation = r;
+        }
+    }
+    return rotation;
+}
+
+bool dictionary_index::identify(uint64_t code, int &id, int &rotation) const {
+    CV_Assert(tolerance >= 0);
+    id = -1;
+
+    unordered_map< uint64_t, uint32_t >::const_iterator hit = exact.find(code);
+    if(hit != exact.end() && tolerance < lowerDistances[hit->second]) {
+        id = (int)(hit->second / 4);
+        rotation = (int)(hit->second % 4);
+        return true;
+    }
+    // the hash keeps the lowest id of a code, which has no lower id at distance 0
+    if(tolerance == 0)
+        return false;
+
+    if(chunks.empty()) {
+        for(int candidate = 0; candidate < markerCount; candidate++) {
+            rotation = bestRotation(candidate, code);
+            if(rotation >= 0) {
+                id = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    for(size_t c = 0; c < chunks.size(); c++) {
+        pair< uint64_t, uint32_t > key(chunkOf(code, c), 0);
+        vector< pair< uint64_t, uint32_t > >::const_iterator it =
+                lower_bound(chunks[c].begin(), chunks[c].end(), key);
+        for(; it != chunks[c].end() && it->first == key.first; ++it) {
+            int candidate = (int)(it->second / 4);
+            // ids at or above the best so far can not win
+            if(id >= 0 && candidate >= id)
+                continue;
+            int r = bestRotation(candidate, code);
+            if(r >= 0) {
+                id = candidate;
+                rotation = r;
+            }
+        }
+    }
+    return id >= 0;
+}
+
+uint64_t dictionary_index::packBits(const Mat &bits, int markerSize, int borderBits) {
+    // same order as Dictionary::getByteListFromBits: row major, each byte filled from its high bit, the
+    // last partial byte keeping its bits at the bottom
+    int total = markerSize * markerSize;
+    uint64_t code = 0;
+    uint64_t byte = 0;
+    int i = 0;
+    for(int y = 0; y < markerSize; y++) {
+        const uchar *row = bits.ptr< uchar >(y + borderBits) + borderBits;
+        for(int x = 0; x < markerSize; x++, i++) {
+            byte = (byte << 1) | (row[x] != 0);
+            if(i % 8 == 7 || i == total - 1) {
+                code |= byte << (8 * (i / 8));
+                byte = 0;
+            }
+        }
+    }
+    return code;
+}
@@ -0,0 +1,74 @@
+//
+// Marker identification through hash lookups instead of a scan of the whole dictionary.
+//
+
+#ifndef ARUCO_TEST_DICTIONARY_INDEX_H
+#define ARUCO_TEST_DICTIONARY_INDEX_H
+
+#include <opencv2/aruco.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Every rotation of every marker packed into a 64 bit word, the bytes of the word laid out like
+ * Dictionary::bytesList so the Hamming distance is one popcount. A candidate with no error is found by
+ * hashing its code, unless a lower id is within the tolerance of that code too. Otherwise the code is
+ * split into maxCorrection + 1 chunks: a marker within maxCorrection bits of the candidate matches it
+ * exactly on at least one chunk, so only the markers sharing a chunk with the candidate are compared,
+ * found by binary search in one sorted table per chunk.
+ *
+ * The result is the one Dictionary::identify gives: the lowest id within the tolerance, in the rotation
+ * with the fewest errors.
+ */
+class dictionary_index {
+public:
+    /**
+     * Index a dictionary of at most 8x8 bits, see supports
+     */
+    explicit dictionary_index(const cv::Ptr<cv::aruco::Dictionary> &dictionary);
+
+    /** Dictionaries whose markers fit in a 64 bit code */
+    static bool supports(const cv::aruco::Dictionary &dictionary);
+
+    /**
+     * Build the chunk tables for a tolerance, identify only reads them so it can run in parallel after
+     * this. Nothing to do when they already are for this tolerance.
+     *
+     * @param maxCorrection errors allowed, maxCorrectionBits * errorCorrectionRate as in Dictionary::identify
+     */
+    void prepare(int maxCorrection);
+
+    /**
+     * Same contract as Dictionary::identify, with the tolerance given to prepare
+     *
+     * @param code the candidate's inner bits packed by packBits
+     */
+    bool identify(uint64_t code, int &id, int &rotation) const;
+
+    /**
+     * Pack the cells of a bit Mat, inside a border of borderBits, in the layout of the index
+     */
+    static uint64_t packBits(const cv::Mat &bits, int markerSize, int borderBits);
+
+    const cv::Ptr<cv::aruco::Dictionary> &indexedDictionary() const { return dictionary; }
+
+private:
+    uint64_t chunkOf(uint64_t code, size_t chunk) const;
+    int bestRotation(int candidate, uint64_t code) const;
+
+    cv::Ptr<cv::aruco::Dictionary> dictionary;
+    int markerCount;
+    std::vector< uint64_t > codes;                          // markerCount * 4, rotation r of id at 4 id + r
+    std::unordered_map< uint64_t, uint32_t > exact;         // code to 4 id + r, lowest id and rotation kept
+    std::vector< int > lowerDistances;                      // per code, to the nearest code of a lower id
+
+    int tolerance;
+    std::vector< int > chunkStarts;                         // first bit of each chunk, and the end
+    // per chunk, the chunk value of every code and its 4 id + r, sorted
+    std::vector< std::vector< std::pair< uint64_t, uint32_t > > > chunks;
+};
+
+
+#endif //ARUCO_TEST_DICTIONARY_INDEX_H
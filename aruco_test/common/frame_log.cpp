@@ -0,0 +1,373 @@
+#include "frame_log.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    const char fileMagic[8] = {'F', 'R', 'A', 'M', 'E', 'L', 'O', 'G'};
+    const uint32_t fileVersion = 1;
+    const uint32_t recordMagic = 0x43455246;   // "FREC"
+
+    // the mapping grows in steps this large, so the writer seldom has to remap
+    const size_t growStep = 64 * 1024 * 1024;
+
+    // values per block of the packed encoding, packed in two groups of 8
+    const int blockValues = 16;
+
+    struct frame_log_header {
+        char magic[8];
+        uint32_t version;
+        uint32_t headerBytes;
+        uint8_t reserved[16];
+    };
+
+    size_t roundUp(size_t n, size_t multiple) {
+        return (n + multiple - 1) / multiple * multiple;
+    }
+
+    size_t rowBytes(const Size &size, int type) {
+        return (size_t)size.width * CV_ELEM_SIZE(type);
+    }
+
+    /** Largest payload a packed frame can take, one width byte and 16 bytes for every 16 values */
+    size_t packedBound(const Size &size, int type) {
+        size_t blocks = (rowBytes(size, type) + blockValues - 1) / blockValues;
+        return blocks * (blockValues + 1) * (size_t)size.height;
+    }
+
+    uchar zigzag(int residual) {
+        int8_t r = (int8_t)residual;
+        return (uchar)(((uint8_t)r << 1) ^ (uint8_t)(r >> 7));
+    }
+
+    uchar unzigzag(uchar value) {
+        return (uchar)((value >> 1) ^ (uchar)-(int)(value & 1));
+    }
+
+    int bitWidth(uchar value) {
+        int bits = 0;
+        while(value != 0) {
+            bits++;
+            value >>= 1;
+        }
+        return bits;
+    }
+
+    /**
+     * Pack a row: the difference of every byte to the one a pixel to its left, zigzagged so small changes
+     * either way are small numbers, then blocks of 16 behind the width of their largest value.
+     *
+     * @return bytes written to out
+     */
+    size_t packRow(const uchar *row, size_t length, int channels, uchar *out) {
+        uchar *start = out;
+        uchar values[blockValues];
+        for(size_t x = 0; x < length; x += blockValues) {
+            size_t count = min((size_t)blockValues, length - x);
+            uchar all = 0;
+            for(size_t i = 0; i < count; i++) {
+                size_t at = x + i;
+                int left = at >= (size_t)channels ? row[at - channels] : 0;
+                values[i] = zigzag(row[at] - left);
+                all |= values[i];
+            }
+            for(size_t i = count; i < blockValues; i++)
+                values[i] = 0;
+
+            int bits = bitWidth(all);
+            *out++ = (uchar)bits;
+            if(bits == 0)
+                continue;
+            for(int group = 0; group < blockValues; group += 8) {
+                uint64_t packed = 0;
+                for(int i = 0; i < 8; i++)
+                    packed |= (uint64_t)values[group + i] << (i * bits);
+                // little endian, the low bits go first
+                memcpy(out, &packed, (size_t)bits);
+                out += bits;
+            }
+        }
+        return (size_t)(out - start);
+    }
+
+    /**
+     * Undo packRow
+     *
+     * @return bytes read from in, 0 if the row runs past end
+     */
+    size_t unpackRow(const uchar *in, const uchar *end, size_t length, int channels, uchar *row) {
+        const uchar *start = in;
+        for(size_t x = 0; x < length; x += blockValues) {
+            if(in >= end)
+                return 0;
+            int bits = *in++;
+            if(bits > 8 || in + 2 * bits > end)
+                return 0;
+            size_t count = min((size_t)blockValues, length - x);
+            uint64_t mask = (1u << bits) - 1;
+            for(int group = 0; group < blockValues; group += 8) {
+                uint64_t packed = 0;
+                memcpy(&packed, in, (size_t)bits);
+                in += bits;
+                for(int i = 0; i < 8 && (size_t)(group + i) < count; i++) {
+                    size_t at = x + group + i;
+                    int left = at >= (size_t)channels ? row[at - channels] : 0;
+                    row[at] = (uchar)(left + unzigzag((uchar)((packed >> (i * bits)) & mask)));
+                }
+            }
+        }
+        return (size_t)(in - start);
+    }
+}
+
+frame_log_writer::frame_log_writer(const string &path, bool compress, size_t queueSize)
+        : compress(compress), fd(-1), mapping(nullptr), mappingSize(0), used(0),
+          queue(queueSize, QUEUE_DROP_OLDEST), written(0), failed(0) {
+    int file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if(file < 0) {
+        cerr << "Could not create " << path << ": " << strerror(errno) << endl;
+        return;
+    }
+    fd = file;
+    if(!reserve(sizeof(frame_log_header))) {
+        cerr << "Could not map " << path << ": " << strerror(errno) << endl;
+        ::close(fd);
+        fd = -1;
+        return;
+    }
+
+    frame_log_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, fileMagic, sizeof(fileMagic));
+    header.version = fileVersion;
+    header.headerBytes = sizeof(header);
+    memcpy(mapping, &header, sizeof(header));
+    used = sizeof(header);
+
+    writer = thread(&frame_log_writer::run, this);
+}
+
+frame_log_writer::~frame_log_writer() {
+    close();
+}
+
+void frame_log_writer::append(const frame_handle &frame, const capture_stamp &stamp) {
+    if(fd < 0 || frame.empty())
+        return;
+    queue.push(log_entry{frame, stamp});
+}
+
+void frame_log_writer::close() {
+    queue.close();
+    if(writer.joinable())
+        writer.join();
+    if(fd < 0)
+        return;
+    if(mapping != nullptr)
+        munmap(mapping, mappingSize);
+    mapping = nullptr;
+    mappingSize = 0;
+    // the mapping grew in large steps, cut the file back to the records
+    if(ftruncate(fd, (off_t)used.load()) < 0)
+        cerr << "Could not truncate the frame log: " << strerror(errno) << endl;
+    ::close(fd);
+    fd = -1;
+}
+
+void frame_log_writer::run() {
+    log_entry entry;
+    while(queue.pop(entry)) {
+        if(write(entry.frame.mat(), entry.stamp))
+            written.fetch_add(1, memory_order_relaxed);
+        else
+            failed.fetch_add(1, memory_order_relaxed);
+        // the capture buffer goes back before the writer waits for the next frame
+        entry.frame.release();
+    }
+}
+
+bool frame_log_writer::write(const Mat &image, const capture_stamp &stamp) {
+    Size size = image.size();
+    int type = image.type();
+    size_t length = rowBytes(size, type);
+    bool pack = compress && image.depth() == CV_8U;
+    size_t bound = pack ? packedBound(size, type) : length * size.height;
+    if(!reserve(sizeof(frame_log_record) + roundUp(bound, 8)))
+        return false;
+
+    uint64_t offset = used.load(memory_order_relaxed);
+    uchar *payload = mapping + offset + sizeof(frame_log_record);
+    size_t payloadBytes = 0;
+    for(int y = 0; y < size.height; y++) {
+        const uchar *row = image.ptr< uchar >(y);
+        if(pack) {
+            payloadBytes += packRow(row, length, image.channels(), payload + payloadBytes);
+        } else {
+            memcpy(payload + payloadBytes, row, length);
+            payloadBytes += length;
+        }
+    }
+    size_t padded = roundUp(payloadBytes, 8);
+    memset(payload + payloadBytes, 0, padded - payloadBytes);
+
+    frame_log_record record;
+    record.magic = recordMagic;
+    record.encoding = pack ? FRAME_LOG_PACKED : FRAME_LOG_RAW;
+    record.sequence = stamp.sequence;
+    record.monotonicUs = stamp.monotonicUs;
+    record.wallUs = stamp.wallUs;
+    record.width = (uint32_t)size.width;
+    record.height = (uint32_t)size.height;
+    record.type = (uint32_t)type;
+    record.payloadBytes = (uint32_t)payloadBytes;
+    memcpy(mapping + offset, &record, sizeof(record));
+
+    used.store(offset + sizeof(record) + padded, memory_order_relaxed);
+    return true;
+}
+
+bool frame_log_writer::reserve(size_t bytes) {
+    size_t needed = used.load(memory_order_relaxed) + bytes;
+    if(needed <= mappingSize)
+        return true;
+
+    size_t grown = roundUp(needed, growStep);
+    if(ftruncate(fd, (off_t)grown) < 0)
+        return false;
+    void *base = mapping == nullptr
+                 ? mmap(nullptr, grown, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+                 : mremap(mapping, mappingSize, grown, MREMAP_MAYMOVE);
+    if(base == MAP_FAILED)
+        return false;
+    mapping = static_cast< uchar * >(base);
+    mappingSize = grown;
+    return true;
+}
+
+frame_log_reader::~frame_log_reader() {
+    if(mapping != nullptr)
+        munmap(mapping, mappingSize);
+}
+
+bool frame_log_reader::isFrameLog(const string &path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+        return false;
+    char magic[sizeof(fileMagic)];
+    bool isLog = ::read(fd, magic, sizeof(magic)) == (ssize_t)sizeof(magic) &&
+                 memcmp(magic, fileMagic, sizeof(fileMagic)) == 0;
+    ::close(fd);
+    return isLog;
+}
+
+bool frame_log_reader::open(const string &path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0) {
+        cerr << "Could not open " << path << ": " << strerror(errno) << endl;
+        return false;
+    }
+    struct stat info;
+    if(fstat(fd, &info) < 0 || (size_t)info.st_size < sizeof(frame_log_header)) {
+        cerr << path << " is not a frame log" << endl;
+        ::close(fd);
+        return false;
+    }
+    size_t size = (size_t)info.st_size;
+    void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(data == MAP_FAILED) {
+        cerr << "Could not map " << path << ": " << strerror(errno) << endl;
+        return false;
+    }
+
+    frame_log_header header;
+    memcpy(&header, data, sizeof(header));
+    if(memcmp(header.magic, fileMagic, sizeof(fileMagic)) != 0 || header.version != fileVersion ||
+       header.headerBytes < sizeof(header) || header.headerBytes > size) {
+        cerr << path << " is not a frame log of version " << fileVersion << endl;
+        munmap(data, size);
+        return false;
+    }
+
+    if(mapping != nullptr)
+        munmap(mapping, mappingSize);
+    mapping = static_cast< uchar * >(data);
+    mappingSize = size;
+    madvise(mapping, mappingSize, MADV_SEQUENTIAL);
+    offset = header.headerBytes;
+    current = nullptr;
+    return true;
+}
+
+bool frame_log_reader::next(capture_stamp &stamp) {
+    if(mapping == nullptr)
+        return false;
+    if(current != nullptr)
+        offset += sizeof(frame_log_record) + roundUp(current->payloadBytes, 8);
+    current = nullptr;
+
+    // a record cut short or never finished ends the log
+    if(offset + sizeof(frame_log_record) > mappingSize)
+        return false;
+    const frame_log_record *record = reinterpret_cast< const frame_log_record * >(mapping + offset);
+    if(record->magic != recordMagic || record->encoding > FRAME_LOG_PACKED ||
+       offset + sizeof(frame_log_record) + record->payloadBytes > mappingSize)
+        return false;
+    Size size((int)record->width, (int)record->height);
+    if(size.area() <= 0 || (record->encoding == FRAME_LOG_RAW &&
+                            record->payloadBytes != rowBytes(size, (int)record->type) * size.height))
+        return false;
+
+    current = record;
+    stamp.sequence = record->sequence;
+    stamp.monotonicUs = record->monotonicUs;
+    stamp.wallUs = record->wallUs;
+    return true;
+}
+
+Size frame_log_reader::frameSize() const {
+    return current != nullptr ? Size((int)current->width, (int)current->height) : Size();
+}
+
+int frame_log_reader::frameType() const {
+    return current != nullptr ? (int)current->type : -1;
+}
+
+bool frame_log_reader::packed() const {
+    return current != nullptr && current->encoding == FRAME_LOG_PACKED;
+}
+
+bool frame_log_reader::frame(Mat &image) const {
+    if(current == nullptr)
+        return false;
+    uchar *payload = mapping + offset + sizeof(frame_log_record);
+    Size size = frameSize();
+    int type = frameType();
+    if(current->encoding == FRAME_LOG_RAW) {
+        image = Mat(size, type, payload);
+        return true;
+    }
+
+    // a raw frame handed out before is a view of the log, never unpack over it
+    if(image.data >= mapping && image.data < mapping + mappingSize)
+        image.release();
+    image.create(size, type);
+    const uchar *end = payload + current->payloadBytes;
+    size_t length = rowBytes(size, type);
+    for(int y = 0; y < size.height; y++) {
+        size_t read = unpackRow(payload, end, length, image.channels(), image.ptr< uchar >(y));
+        if(read == 0)
+            return false;
+        payload += read;
+    }
+    return true;
+}
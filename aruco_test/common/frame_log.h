@@ -0,0 +1,144 @@
+//
+// Append-only, memory mapped log of captured frames with their stamps, for replaying exactly what a detector saw.
+//
+
+#ifndef ARUCO_TEST_FRAME_LOG_H
+#define ARUCO_TEST_FRAME_LOG_H
+
+#include <opencv2/core.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include "capture_stamp.h"
+#include "frame_pool.h"
+#include "spsc_queue.h"
+
+/**
+ * Layout of a log: a file header, then records back to back, each a record header followed by its payload
+ * padded to 8 bytes. Raw payloads are the frame's rows without padding. Packed payloads hold every row's
+ * differences to the pixel on the left, zigzagged and bit packed in blocks of 16 bytes behind a byte giving
+ * their width, so flat image regions shrink to a sixteenth and sensor noise to about half. Only 8 bit frames
+ * are packed. A record whose magic is not there ends the log, so a log cut short by a crash reads up to its
+ * last whole frame.
+ */
+struct frame_log_record {
+    uint32_t magic;
+    uint32_t encoding;          // FRAME_LOG_RAW or FRAME_LOG_PACKED
+    uint64_t sequence;
+    uint64_t monotonicUs;
+    uint64_t wallUs;
+    uint32_t width;
+    uint32_t height;
+    uint32_t type;              // OpenCV type of the frame
+    uint32_t payloadBytes;      // without the padding
+};
+
+enum frame_log_encoding {
+    FRAME_LOG_RAW = 0,
+    FRAME_LOG_PACKED = 1
+};
+
+/** Frames a writer queues unless told otherwise, each one holds a capture buffer */
+const size_t frameLogQueueSize = 8;
+
+/**
+ * Writes frames on a thread of its own. append only queues a reference to the frame, so capture never waits
+ * for the disk. When the writer falls behind, the oldest queued frame is dropped and counted.
+ * Pages of the file are written through a shared mapping that grows in large steps, and the file is cut to
+ * its length when the writer closes.
+ */
+class frame_log_writer {
+public:
+    /**
+     * @param compress pack 8 bit frames losslessly
+     * @param queueSize frames queued for the writer, each holds on to its capture buffer
+     */
+    frame_log_writer(const std::string &path, bool compress, size_t queueSize = frameLogQueueSize);
+    ~frame_log_writer();
+
+    frame_log_writer(const frame_log_writer &) = delete;
+    frame_log_writer &operator=(const frame_log_writer &) = delete;
+
+    /** False if the file could not be created, the reason is printed */
+    bool isOpen() const { return fd >= 0; }
+
+    /** Queue a frame for the log, call from the capturing thread */
+    void append(const frame_handle &frame, const capture_stamp &stamp);
+
+    /** Drain the queue and close the file, done by the destructor too */
+    void close();
+
+    size_t writtenCount() const { return written.load(std::memory_order_relaxed); }
+    size_t droppedCount() const { return queue.droppedCount() + failed.load(std::memory_order_relaxed); }
+    uint64_t bytesWritten() const { return used.load(std::memory_order_relaxed); }
+
+private:
+    struct log_entry {
+        frame_handle frame;
+        capture_stamp stamp;
+    };
+
+    void run();
+    bool write(const cv::Mat &image, const capture_stamp &stamp);
+    bool reserve(size_t bytes);
+
+    bool compress;
+    int fd;
+    uchar *mapping;
+    size_t mappingSize;
+    std::atomic<uint64_t> used;
+
+    spsc_queue< log_entry > queue;
+    std::thread writer;
+    std::atomic<size_t> written;
+    std::atomic<size_t> failed;
+};
+
+/**
+ * Streams a log back from a copy on write mapping. Raw frames are handed out in place, packed frames are
+ * unpacked into the caller's Mat. The reader has to outlive the raw frames it handed out.
+ */
+class frame_log_reader {
+public:
+    frame_log_reader() = default;
+    ~frame_log_reader();
+
+    frame_log_reader(const frame_log_reader &) = delete;
+    frame_log_reader &operator=(const frame_log_reader &) = delete;
+
+    /** True if the file starts like a frame log */
+    static bool isFrameLog(const std::string &path);
+
+    /** Map a log, false with the reason printed if it is not one */
+    bool open(const std::string &path);
+
+    /**
+     * Move to the next record
+     *
+     * @param stamp receives the recorded capture stamp
+     * @return false at the end of the log
+     */
+    bool next(capture_stamp &stamp);
+
+    cv::Size frameSize() const;
+    int frameType() const;
+    bool packed() const;
+
+    /**
+     * The frame of the current record
+     *
+     * @param image a header over the mapping for raw records, packed records are unpacked into it
+     */
+    bool frame(cv::Mat &image) const;
+
+private:
+    uchar *mapping = nullptr;
+    size_t mappingSize = 0;
+    size_t offset = 0;
+    const frame_log_record *current = nullptr;
+};
+
+
+#endif //ARUCO_TEST_FRAME_LOG_H
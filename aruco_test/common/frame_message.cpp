@@ -0,0 +1,144 @@
+#include "frame_message.h"
+
+#include <algorithm>
+#include "rotation.h"
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    /**
+     * The Rodrigues vector's rotation again as a quaternion and as {roll, pitch, yaw} about x, y and z
+     */
+    void setRotation(proto::Detection *detection, const Vec3d &rvec) {
+        Vec4d q = rodriguesToQuaternion(rvec);
+        detection->set_qw(q[0]);
+        detection->set_qx(q[1]);
+        detection->set_qy(q[2]);
+        detection->set_qz(q[3]);
+        Vec3d taitBryanAngles = quaternionToTaitBryan(q);
+        detection->set_roll(taitBryanAngles[0]);
+        detection->set_pitch(taitBryanAngles[1]);
+        detection->set_yaw(taitBryanAngles[2]);
+    }
+
+    void setPose(proto::Detection *detection, const Vec3d &rvec, const Vec3d &tvec, double reprojectionError) {
+        detection->set_x(tvec[0]);
+        detection->set_y(tvec[1]);
+        detection->set_z(tvec[2]);
+        detection->set_rx(rvec[0]);
+        detection->set_ry(rvec[1]);
+        detection->set_rz(rvec[2]);
+        setRotation(detection, rvec);
+        detection->set_reprojectionerror(reprojectionError);
+    }
+
+    /**
+     * Filtered or predicted pose with the filter's variance and velocity
+     */
+    void setTrackedPose(proto::Detection *detection, const tracked_pose &track) {
+        detection->set_x(track.tvec[0]);
+        detection->set_y(track.tvec[1]);
+        detection->set_z(track.tvec[2]);
+        detection->set_rx(track.rvec[0]);
+        detection->set_ry(track.rvec[1]);
+        detection->set_rz(track.rvec[2]);
+        setRotation(detection, track.rvec);
+        detection->set_predicted(!track.measured);
+        for(int i = 0; i < 6; i++)
+            detection->add_posevariance(track.variance[i]);
+        for(int i = 0; i < 3; i++)
+            detection->add_velocity(track.tvecRate[i]);
+        for(int i = 0; i < 3; i++)
+            detection->add_velocity(track.rvecRate[i]);
+    }
+
+    const tracked_pose *findTrack(const frame_result &result, int id) {
+        for(size_t i = 0; i < result.tracks.size(); i++) {
+            if(result.tracks[i].id == id)
+                return &result.tracks[i];
+        }
+        return nullptr;
+    }
+
+    google::protobuf::ArenaOptions arenaOptions(vector< char > &block) {
+        google::protobuf::ArenaOptions options;
+        options.initial_block = block.data();
+        options.initial_block_size = block.size();
+        return options;
+    }
+}
+
+void fillFrameMessage(const detection_setup &setup, const frame_result &result, uint32_t frameIndex,
+                      const capture_stamp &stamp, proto::FrameDetections &message) {
+    message.Clear();
+    message.set_frameindex(frameIndex);
+    message.set_sequence(stamp.sequence);
+    message.set_capturemonotonicus(stamp.monotonicUs);
+    message.set_capturewallus(stamp.wallUs);
+    message.set_cameraid((uint32_t)setup.cameraId);
+
+    bool markerPoses = setup.target == TARGET_MARKERS && result.rvecs.size() == result.ids.size();
+    for(size_t i = 0; i < result.ids.size(); i++) {
+        proto::Detection *detection = message.add_detections();
+        detection->set_id(result.ids[i]);
+        for(size_t c = 0; c < result.corners[i].size(); c++) {
+            detection->add_corners(result.corners[i][c].x);
+            detection->add_corners(result.corners[i][c].y);
+        }
+        if(!markerPoses)
+            continue;
+        setPose(detection, result.rvecs[i], result.tvecs[i], result.reprojectionErrors[i]);
+        if(i < result.squarePoses.size() && result.squarePoses[i].valid)
+            detection->set_alternativereprojectionerror(result.squarePoses[i].errors[1]);
+        const tracked_pose *track = findTrack(result, result.ids[i]);
+        if(track != nullptr)
+            setTrackedPose(detection, *track);
+    }
+
+    if(setup.target == TARGET_MARKERS) {
+        // markers the filter still predicts after losing them
+        for(size_t i = 0; i < result.tracks.size(); i++) {
+            if(result.tracks[i].measured)
+                continue;
+            proto::Detection *detection = message.add_detections();
+            detection->set_id(result.tracks[i].id);
+            setTrackedPose(detection, result.tracks[i]);
+        }
+        return;
+    }
+
+    const tracked_pose *boardTrack = findTrack(result, -1);
+    if(!result.rvecs.empty() || boardTrack != nullptr) {
+        proto::Detection *detection = message.add_detections();
+        detection->set_id(-1);
+        if(!result.rvecs.empty())
+            setPose(detection, result.rvecs[0], result.tvecs[0], result.reprojectionErrors[0]);
+        if(boardTrack != nullptr)
+            setTrackedPose(detection, *boardTrack);
+    }
+}
+
+frame_publisher::frame_publisher(size_t arenaBytes, size_t poolBuffers)
+        : arenaBlock(max((size_t)1024, arenaBytes)), arena(arenaOptions(arenaBlock)), message(nullptr),
+          buffers(poolBuffers) {}
+
+proto::FrameDetections &frame_publisher::nextMessage() {
+    // Reset frees every block but the initial one, which is all a frame normally needs
+    message = nullptr;
+    arena.Reset();
+    message = google::protobuf::Arena::CreateMessage< proto::FrameDetections >(&arena);
+    return *message;
+}
+
+void frame_publisher::send(zmq::socket_t &socket, stage_latencies *latencies) {
+    stage_timer serializeTimer(latencies, STAGE_SERIALIZE);
+    size_t size = message->ByteSizeLong();
+    zmq::message_t request;
+    buffers.acquire(request, size);
+    message->SerializeWithCachedSizesToArray(static_cast< google::protobuf::uint8 * >(request.data()));
+    serializeTimer.stop();
+
+    stage_timer sendTimer(latencies, STAGE_SEND);
+    socket.send(request);
+}
@@ -0,0 +1,63 @@
+//
+// The one message every detector sends per processed frame.
+//
+
+#ifndef ARUCO_TEST_FRAME_MESSAGE_H
+#define ARUCO_TEST_FRAME_MESSAGE_H
+
+#include <google/protobuf/arena.h>
+#include <cstdint>
+#include <vector>
+#include <zmq.hpp>
+#include "../gen/pose.pb.h"
+#include "capture_stamp.h"
+#include "detection_stages.h"
+#include "latency_stats.h"
+#include "message_pool.h"
+
+/**
+ * Fill message with every marker of the frame. Single markers carry their own pose, for the board
+ * targets the markers only have corners and the board pose follows as one more detection with id -1.
+ * With a pose filter the poses are the filtered ones, and ids the filter predicts through a dropout follow
+ * as detections without corners. Every pose also carries its rotation as a quaternion and as Euler angles.
+ *
+ * @param stamp capture time and sequence number of the frame
+ */
+void fillFrameMessage(const detection_setup &setup, const frame_result &result, uint32_t frameIndex,
+                      const capture_stamp &stamp, proto::FrameDetections &message);
+
+/**
+ * Sends the frame messages without allocating once it is warmed up. The message of a frame lives on a
+ * protobuf arena that starts over every frame and keeps its first block, and it is serialized straight
+ * into a pooled ZeroMQ buffer, sized up front with ByteSizeLong.
+ *
+ * Like its message_pool, create it before the zmq::context_t.
+ */
+class frame_publisher {
+public:
+    /**
+     * @param arenaBytes first arena block, frames whose message fits never allocate
+     * @param poolBuffers messages that can be in flight at once before sends fall back to ZeroMQ's buffers
+     */
+    explicit frame_publisher(size_t arenaBytes = 64 * 1024, size_t poolBuffers = 4);
+
+    /**
+     * A cleared message for the next frame, valid until the next call
+     */
+    proto::FrameDetections &nextMessage();
+
+    /**
+     * Serialize and send the message of the frame, timing both stages into latencies unless it is null
+     */
+    void send(zmq::socket_t &socket, stage_latencies *latencies = nullptr);
+
+    const message_pool &pool() const { return buffers; }
+
+private:
+    std::vector< char > arenaBlock;
+    google::protobuf::Arena arena;
+    proto::FrameDetections *message;
+    message_pool buffers;
+};
+
+#endif //ARUCO_TEST_FRAME_MESSAGE_H
@@ -0,0 +1,219 @@
+#include "frame_pool.h"
+
+#include <sys/mman.h>
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    const size_t pageSize = 4096;
+    const size_t hugePageSize = 2 * 1024 * 1024;
+
+    size_t roundUp(size_t n, size_t multiple) {
+        return (n + multiple - 1) / multiple * multiple;
+    }
+}
+
+bool parseFramePages(const string &name, frame_pages &pages) {
+    if(name == "normal") {
+        pages = FRAME_PAGES_NORMAL;
+        return true;
+    }
+    if(name == "thp") {
+        pages = FRAME_PAGES_TRANSPARENT;
+        return true;
+    }
+    if(name == "huge") {
+        pages = FRAME_PAGES_EXPLICIT;
+        return true;
+    }
+    return false;
+}
+
+frame_handle::frame_handle(const frame_handle &other) : buffer(other.buffer), image(other.image) {
+    if(buffer != nullptr)
+        buffer->references.fetch_add(1, memory_order_relaxed);
+}
+
+frame_handle::frame_handle(frame_handle &&other) noexcept : buffer(other.buffer), image(other.image) {
+    other.buffer = nullptr;
+    other.image.release();
+}
+
+frame_handle &frame_handle::operator=(const frame_handle &other) {
+    if(this != &other) {
+        release();
+        buffer = other.buffer;
+        image = other.image;
+        if(buffer != nullptr)
+            buffer->references.fetch_add(1, memory_order_relaxed);
+    }
+    return *this;
+}
+
+frame_handle &frame_handle::operator=(frame_handle &&other) noexcept {
+    if(this != &other) {
+        release();
+        buffer = other.buffer;
+        image = other.image;
+        other.buffer = nullptr;
+        other.image.release();
+    }
+    return *this;
+}
+
+void frame_handle::release() {
+    image.release();
+    if(buffer == nullptr)
+        return;
+    frame_owner::buffer_slot *released = buffer;
+    buffer = nullptr;
+    if(released->references.fetch_sub(1, memory_order_acq_rel) == 1)
+        released->owner->put(released);
+}
+
+void frame_owner::handOut(buffer_slot *buffer, const Mat &image, frame_handle &frame) {
+    frame.release();
+    buffer->references.store(1, memory_order_relaxed);
+    frame.buffer = buffer;
+    frame.image = image;
+}
+
+frame_pool::frame_pool(size_t bufferCount, frame_pages pages)
+        : pages(pages), slots(max((size_t)1, bufferCount)), frameType(-1), frameStep(0), mapping(nullptr),
+          mappingSize(0), explicitHugePages(false), exhausted(0), mismatched(0) {
+    for(size_t i = 0; i < slots.size(); i++) {
+        slots[i].owner = this;
+        slots[i].data = nullptr;
+        slots[i].references = 0;
+    }
+    freeSlots.reserve(slots.size());
+}
+
+frame_pool::~frame_pool() {
+    unmap();
+}
+
+bool frame_pool::retrieve(VideoCapture &capture, frame_handle &frame) {
+    frame.release();
+    if(acquire(frame)) {
+        const uchar *data = frame.image.data;
+        if(!capture.retrieve(frame.image)) {
+            frame.release();
+            return false;
+        }
+        if(frame.image.data == data)
+            return true;
+
+        // retrieve had to reallocate, the frame does not fit the buffers
+        mismatched.fetch_add(1, memory_order_relaxed);
+        Mat own = frame.image;
+        frame.release();
+        frame.image = own;
+    } else if(!capture.retrieve(frame.image)) {
+        return false;
+    }
+
+    // the first frame sizes the buffers, as does a new frame size once no buffer is in use
+    if(!frame.image.empty() && (frame.image.size() != frameSize || frame.image.type() != frameType) &&
+       reserve(frame.image.size(), frame.image.type())) {
+        frame_handle pooledFrame;
+        if(acquire(pooledFrame)) {
+            frame.image.copyTo(pooledFrame.image);
+            frame = std::move(pooledFrame);
+        }
+    }
+    return !frame.empty();
+}
+
+bool frame_pool::acquire(frame_handle &frame) {
+    frame.release();
+    buffer_slot *free = nullptr;
+    {
+        lock_guard<std::mutex> lock(mutex);
+        if(mapping == nullptr)
+            return false;
+        if(freeSlots.empty()) {
+            exhausted.fetch_add(1, memory_order_relaxed);
+            return false;
+        }
+        free = freeSlots.back();
+        freeSlots.pop_back();
+    }
+
+    handOut(free, Mat(frameSize, frameType, free->data, frameStep), frame);
+    return true;
+}
+
+bool frame_pool::reserve(const Size &size, int type) {
+    lock_guard<std::mutex> lock(mutex);
+    if(mapping != nullptr && size == frameSize && type == frameType)
+        return true;
+    if(mapping != nullptr && freeSlots.size() != slots.size())
+        return false;
+    unmap();
+    if(size.area() <= 0)
+        return false;
+
+    // rows padded to a cache line, buffers to a page
+    size_t step = roundUp((size_t)size.width * CV_ELEM_SIZE(type), 64);
+    size_t bufferSize = roundUp(step * size.height, pageSize);
+    size_t total = bufferSize * slots.size();
+
+    // kept when the mapping fails too, so frames of this size do not retry it every time
+    frameSize = size;
+    frameType = type;
+    frameStep = step;
+
+    void *base = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if(pages == FRAME_PAGES_EXPLICIT) {
+        mappingSize = roundUp(total, hugePageSize);
+        base = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_POPULATE, -1, 0);
+        explicitHugePages = base != MAP_FAILED;
+    }
+#endif
+    if(base == MAP_FAILED) {
+        mappingSize = total;
+        base = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(base == MAP_FAILED)
+            return false;
+#ifdef MADV_HUGEPAGE
+        // explicit pages that could not be had fall back to transparent ones
+        if(pages != FRAME_PAGES_NORMAL)
+            madvise(base, mappingSize, MADV_HUGEPAGE);
+#endif
+        // fault every page in now rather than on the first frames
+        memset(base, 0, mappingSize);
+    }
+
+    mapping = base;
+    for(size_t i = 0; i < slots.size(); i++) {
+        slots[i].data = static_cast<uchar *>(base) + i * bufferSize;
+        slots[i].references.store(0, memory_order_relaxed);
+        freeSlots.push_back(&slots[i]);
+    }
+    return true;
+}
+
+size_t frame_pool::inUse() const {
+    lock_guard<std::mutex> lock(mutex);
+    return mapping != nullptr ? slots.size() - freeSlots.size() : 0;
+}
+
+void frame_pool::unmap() {
+    if(mapping != nullptr)
+        munmap(mapping, mappingSize);
+    mapping = nullptr;
+    mappingSize = 0;
+    explicitHugePages = false;
+    freeSlots.clear();
+}
+
+void frame_pool::put(buffer_slot *buffer) {
+    lock_guard<std::mutex> lock(mutex);
+    freeSlots.push_back(buffer);
+}
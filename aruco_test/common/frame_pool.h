@@ -0,0 +1,165 @@
+//
+// Fixed set of aligned frame buffers that capture retrieves into and the stages pass around by handle.
+//
+
+#ifndef ARUCO_TEST_FRAME_POOL_H
+#define ARUCO_TEST_FRAME_POOL_H
+
+#include <opencv2/core.hpp>
+#include <opencv2/videoio.hpp>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Pages the frame buffers are mapped on
+ */
+enum frame_pages {
+    FRAME_PAGES_NORMAL,         // 4 kB pages
+    FRAME_PAGES_TRANSPARENT,    // ask the kernel for transparent huge pages
+    FRAME_PAGES_EXPLICIT        // reserved hugetlbfs pages, normal pages when none are left
+};
+
+/**
+ * Parse "normal", "thp" or "huge" into the frame pages
+ *
+ * @return false if the name is not known
+ */
+bool parseFramePages(const std::string &name, frame_pages &pages);
+
+class frame_handle;
+
+/**
+ * Gives out frame buffers to handles and takes each back once the last handle sharing it lets go
+ */
+class frame_owner {
+public:
+    virtual ~frame_owner() {}
+
+protected:
+    friend class frame_handle;
+
+    struct buffer_slot {
+        frame_owner *owner;
+        uchar *data;
+        std::atomic<int> references;
+    };
+
+    /** Take back a buffer no handle holds anymore, called from the thread that released it */
+    virtual void put(buffer_slot *buffer) = 0;
+
+    /** Make frame the only handle on buffer, with image as its header */
+    static void handOut(buffer_slot *buffer, const cv::Mat &image, frame_handle &frame);
+};
+
+/**
+ * Reference counted share of an owned frame buffer. Copies share the buffer, which goes back to its owner
+ * when the last of them is destroyed or released. A handle without a buffer holds an ordinary Mat.
+ */
+class frame_handle {
+public:
+    frame_handle() : buffer(nullptr) {}
+    explicit frame_handle(const cv::Mat &image) : buffer(nullptr), image(image) {}
+    frame_handle(const frame_handle &other);
+    frame_handle(frame_handle &&other) noexcept;
+    frame_handle &operator=(const frame_handle &other);
+    frame_handle &operator=(frame_handle &&other) noexcept;
+    ~frame_handle() { release(); }
+
+    /** Header over the buffer, valid while the handle holds it */
+    cv::Mat &mat() { return image; }
+    const cv::Mat &mat() const { return image; }
+
+    bool empty() const { return image.empty(); }
+
+    /** True when the frame lives in an owned buffer */
+    bool pooled() const { return buffer != nullptr; }
+
+    /** Let go of the frame, the buffer returns to its owner if no other handle shares it */
+    void release();
+
+private:
+    friend class frame_owner;
+    friend class frame_pool;
+
+    frame_owner::buffer_slot *buffer;
+    cv::Mat image;
+};
+
+/**
+ * Frame buffers carved out of one mapping, each starting on a page so rows are 64 byte aligned for the
+ * SIMD kernels. The mapping is touched when it is made, so no page faults are left for the frame path,
+ * and with huge pages the buffers of a 1080p pool sit on a handful of TLB entries.
+ *
+ * The buffers take their size and type from the first frame retrieved. Frames of another size, and frames
+ * that find every buffer in use, fall back to ordinary Mats and are counted.
+ * The pool has to outlive every handle it gave out.
+ */
+class frame_pool : public frame_owner {
+public:
+    frame_pool(size_t bufferCount, frame_pages pages = FRAME_PAGES_NORMAL);
+    ~frame_pool();
+
+    frame_pool(const frame_pool &) = delete;
+    frame_pool &operator=(const frame_pool &) = delete;
+
+    /**
+     * Retrieve the grabbed frame of capture into a free buffer
+     *
+     * @param frame replaced by the new frame, empty when retrieve fails
+     * @return false if the capture had no frame
+     */
+    bool retrieve(cv::VideoCapture &capture, frame_handle &frame);
+
+    /**
+     * A free buffer for a frame of the pool's size and type
+     *
+     * @return false, and the handle left empty, when every buffer is in use or the pool has no frame size yet
+     */
+    bool acquire(frame_handle &frame);
+
+    /**
+     * Map the buffers for frames of size and type. Only done while no buffer is handed out.
+     *
+     * @return false if buffers are in use or the mapping failed
+     */
+    bool reserve(const cv::Size &size, int type);
+
+    size_t capacity() const { return slots.size(); }
+    size_t inUse() const;
+
+    /** True when the buffers are on explicit huge pages */
+    bool hugePages() const { return explicitHugePages; }
+
+    /** Frames that found every buffer in use */
+    size_t exhaustedCount() const { return exhausted.load(std::memory_order_relaxed); }
+
+    /** Frames that did not match the size or type of the buffers */
+    size_t mismatchCount() const { return mismatched.load(std::memory_order_relaxed); }
+
+protected:
+    void put(buffer_slot *buffer) override;
+
+private:
+    void unmap();
+
+    frame_pages pages;
+    std::vector< buffer_slot > slots;
+    mutable std::mutex mutex;
+    std::vector< buffer_slot * > freeSlots;
+
+    cv::Size frameSize;
+    int frameType;
+    size_t frameStep;
+    void *mapping;
+    size_t mappingSize;
+    bool explicitHugePages;
+
+    std::atomic<size_t> exhausted;
+    std::atomic<size_t> mismatched;
+};
+
+
+#endif //ARUCO_TEST_FRAME_POOL_H
@@ -0,0 +1,160 @@
+#include "integral_threshold.h"
+
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    // above this size 2 * area * 255 no longer fits the float mantissa, such windows use adaptiveThreshold
+    const int maxIntegralWinSize = 181;
+
+    /**
+     * A pixel is set when mean >= pixel + floor(constant). The mean is the box sum S divided the way
+     * boxFilter does it, so the test is rewritten as a * S + b >= c * pixel with every term an integer
+     * below 2^24, which floats compare exactly.
+     */
+    struct window_test {
+        int radius;
+        float a, b, c;
+    };
+
+    window_test makeWindowTest(int winSize, double constant) {
+        int area = winSize * winSize;
+        int idelta = cvFloor(constant);
+        window_test test;
+        test.radius = winSize / 2;
+
+        if(area <= 256) {
+            // boxFilter sums small 8 bit windows in 16 bits and divides with a 16.16 fixed point
+            // reciprocal, mean = ((S + divDelta) * divScale) >> 16
+            double scalef = (double)(1 << 16) / area;
+            int divScale = cvFloor(scalef);
+            int divDelta = area / 2;
+            if(scalef - divScale < 0.5)
+                divDelta++;
+            else
+                divScale++;
+            test.a = (float)divScale;
+            test.b = (float)(divDelta * divScale - (idelta << 16));
+            test.c = (float)(1 << 16);
+        } else {
+            // larger windows round S / area to nearest, halves cannot happen with an odd area,
+            // so mean >= v is 2 * S + area >= 2 * area * v
+            test.a = 2.f;
+            test.b = (float)(area - 2 * area * idelta);
+            test.c = (float)(2 * area);
+        }
+        return test;
+    }
+
+    /**
+     * Threshold one row for one window, tl/tr/bl/br point at the integral image entries of the
+     * window corners for the first pixel of the row
+     */
+    void thresholdRow(const uchar *src, const int *tl, const int *tr, const int *bl, const int *br,
+                      uchar *dst, int width, const window_test &test) {
+        int x = 0;
+#if defined(__AVX2__)
+        const __m256 va = _mm256_set1_ps(test.a), vb = _mm256_set1_ps(test.b), vc = _mm256_set1_ps(test.c);
+        for(; x + 16 <= width; x += 16) {
+            __m128i pixels = _mm_loadu_si128((const __m128i *)(src + x));
+            __m256i pixelWords[2] = {_mm256_cvtepu8_epi32(pixels), _mm256_cvtepu8_epi32(_mm_srli_si128(pixels, 8))};
+            __m256i masks[2];
+            for(int j = 0; j < 2; j++) {
+                int o = x + 8 * j;
+                __m256i sum = _mm256_sub_epi32(
+                        _mm256_add_epi32(_mm256_loadu_si256((const __m256i *)(br + o)),
+                                         _mm256_loadu_si256((const __m256i *)(tl + o))),
+                        _mm256_add_epi32(_mm256_loadu_si256((const __m256i *)(tr + o)),
+                                         _mm256_loadu_si256((const __m256i *)(bl + o))));
+                __m256 lhs = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(sum), va), vb);
+                __m256 rhs = _mm256_mul_ps(_mm256_cvtepi32_ps(pixelWords[j]), vc);
+                masks[j] = _mm256_castps_si256(_mm256_cmp_ps(lhs, rhs, _CMP_GE_OQ));
+            }
+            // packs works per 128 bit lane, put the quarters back in order before the last pack
+            __m256i words = _mm256_permute4x64_epi64(_mm256_packs_epi32(masks[0], masks[1]), _MM_SHUFFLE(3, 1, 2, 0));
+            __m128i bytes = _mm_packs_epi16(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+            _mm_storeu_si128((__m128i *)(dst + x), bytes);
+        }
+#elif defined(__SSE2__)
+        const __m128 va = _mm_set1_ps(test.a), vb = _mm_set1_ps(test.b), vc = _mm_set1_ps(test.c);
+        const __m128i zero = _mm_setzero_si128();
+        for(; x + 16 <= width; x += 16) {
+            __m128i pixels = _mm_loadu_si128((const __m128i *)(src + x));
+            __m128i low = _mm_unpacklo_epi8(pixels, zero), high = _mm_unpackhi_epi8(pixels, zero);
+            __m128i pixelWords[4] = {_mm_unpacklo_epi16(low, zero), _mm_unpackhi_epi16(low, zero),
+                                     _mm_unpacklo_epi16(high, zero), _mm_unpackhi_epi16(high, zero)};
+            __m128i masks[4];
+            for(int j = 0; j < 4; j++) {
+                int o = x + 4 * j;
+                __m128i sum = _mm_sub_epi32(
+                        _mm_add_epi32(_mm_loadu_si128((const __m128i *)(br + o)),
+                                      _mm_loadu_si128((const __m128i *)(tl + o))),
+                        _mm_add_epi32(_mm_loadu_si128((const __m128i *)(tr + o)),
+                                      _mm_loadu_si128((const __m128i *)(bl + o))));
+                __m128 lhs = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(sum), va), vb);
+                __m128 rhs = _mm_mul_ps(_mm_cvtepi32_ps(pixelWords[j]), vc);
+                masks[j] = _mm_castps_si128(_mm_cmpge_ps(lhs, rhs));
+            }
+            __m128i bytes = _mm_packs_epi16(_mm_packs_epi32(masks[0], masks[1]), _mm_packs_epi32(masks[2], masks[3]));
+            _mm_storeu_si128((__m128i *)(dst + x), bytes);
+        }
+#endif
+        for(; x < width; x++) {
+            int sum = br[x] + tl[x] - tr[x] - bl[x];
+            dst[x] = (float)sum * test.a + test.b >= (float)src[x] * test.c ? 255 : 0;
+        }
+    }
+}
+
+void integral_threshold::apply(const Mat &grey, const vector< int > &winSizes, double constant,
+                               vector< Mat > &thresholded) {
+    CV_Assert(grey.type() == CV_8UC1);
+
+    thresholded.resize(winSizes.size());
+    vector< window_test > tests;
+    vector< int > integralWindows;
+    int maxRadius = 0;
+    for(size_t i = 0; i < winSizes.size(); i++) {
+        CV_Assert(winSizes[i] >= 3 && winSizes[i] % 2 == 1);
+        if(winSizes[i] > maxIntegralWinSize) {
+            adaptiveThreshold(grey, thresholded[i], 255, ADAPTIVE_THRESH_MEAN_C, THRESH_BINARY_INV, winSizes[i],
+                              constant);
+            continue;
+        }
+        thresholded[i].create(grey.size(), CV_8UC1);
+        tests.push_back(makeWindowTest(winSizes[i], constant));
+        integralWindows.push_back((int)i);
+        maxRadius = max(maxRadius, winSizes[i] / 2);
+    }
+    if(tests.empty())
+        return;
+
+    // one border replicated integral image serves every window, like the BORDER_REPLICATE | BORDER_ISOLATED
+    // adaptiveThreshold uses. Isolated, so a region the tracker cropped out of a frame replicates its own
+    // edge instead of reading the pixels around it.
+    copyMakeBorder(grey, padded, maxRadius, maxRadius, maxRadius, maxRadius, BORDER_REPLICATE | BORDER_ISOLATED);
+    integral(padded, sums, CV_32S);
+
+    parallel_for_(Range(0, grey.rows), [&](const Range &rows) {
+        for(int y = rows.start; y < rows.end; y++) {
+            const uchar *src = grey.ptr< uchar >(y);
+            for(size_t k = 0; k < tests.size(); k++) {
+                int r = tests[k].radius;
+                const int *top = sums.ptr< int >(y + maxRadius - r);
+                const int *bottom = sums.ptr< int >(y + maxRadius + r + 1);
+                int left = maxRadius - r, right = maxRadius + r + 1;
+                thresholdRow(src, top + left, top + right, bottom + left, bottom + right,
+                             thresholded[integralWindows[k]].ptr< uchar >(y), grey.cols, tests[k]);
+            }
+        }
+    });
+}
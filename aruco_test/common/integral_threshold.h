@@ -0,0 +1,34 @@
+//
+// Adaptive mean thresholding for a whole window size sweep from one integral image.
+//
+
+#ifndef ARUCO_TEST_INTEGRAL_THRESHOLD_H
+#define ARUCO_TEST_INTEGRAL_THRESHOLD_H
+
+#include <opencv2/core.hpp>
+#include <vector>
+
+/**
+ * Replaces one adaptiveThreshold call per window size. The frame is border replicated and summed
+ * into a single integral image, every window's box sum then costs four loads, and each row is
+ * thresholded for all windows while it is in cache. The rows are vectorized with SSE2, or AVX2 when
+ * built with -mavx2, and the output is bit identical to
+ * adaptiveThreshold(grey, out, 255, ADAPTIVE_THRESH_MEAN_C, THRESH_BINARY_INV, winSize, constant)
+ */
+class integral_threshold {
+public:
+    /**
+     * @param grey 8 bit single channel frame
+     * @param winSizes odd window sizes, one output image per size
+     * @param constant subtracted from the mean, same as the adaptiveThreshold C parameter
+     * @param thresholded receives one binary image per window size, the Mats are reused between calls
+     */
+    void apply(const cv::Mat &grey, const std::vector< int > &winSizes, double constant,
+               std::vector< cv::Mat > &thresholded);
+
+private:
+    cv::Mat padded, sums;
+};
+
+
+#endif //ARUCO_TEST_INTEGRAL_THRESHOLD_H
@@ -0,0 +1,80 @@
+#include "latency_stats.h"
+
+using namespace std;
+
+namespace {
+    const char *stageNames[STAGE_COUNT] = {"capture", "convert", "detect", "refine", "interpolate", "pose",
+                                           "filter", "serialize", "send"};
+
+    int highestBit(uint64_t value) {
+        return 63 - __builtin_clzll(value);
+    }
+}
+
+const char *latencyStageName(latency_stage stage) {
+    return stageNames[stage];
+}
+
+latency_histogram::latency_histogram() : maxSample(0), sum(0) {
+    for(int i = 0; i < bucketCount; i++)
+        buckets[i].store(0, memory_order_relaxed);
+}
+
+int latency_histogram::bucketOf(uint64_t micros) {
+    if(micros < (uint64_t)subBuckets)
+        return (int)micros;
+    int exponent = highestBit(micros);
+    if(exponent >= maxExponent)
+        return bucketCount - 1;
+    // the three bits below the leading one pick the sub bucket
+    int sub = (int)((micros >> (exponent - 3)) & (subBuckets - 1));
+    return subBuckets * (exponent - 2) + sub;
+}
+
+uint64_t latency_histogram::bucketUpperBound(int bucket) {
+    if(bucket < subBuckets)
+        return (uint64_t)bucket;
+    int exponent = bucket / subBuckets + 2;
+    uint64_t width = (uint64_t)1 << (exponent - 3);
+    return ((uint64_t)(subBuckets + bucket % subBuckets) << (exponent - 3)) + width - 1;
+}
+
+void latency_histogram::record(uint64_t micros) {
+    buckets[bucketOf(micros)].fetch_add(1, memory_order_relaxed);
+    sum.fetch_add(micros, memory_order_relaxed);
+
+    uint64_t currentMax = maxSample.load(memory_order_relaxed);
+    while(micros > currentMax && !maxSample.compare_exchange_weak(currentMax, micros, memory_order_relaxed)) {}
+}
+
+void latency_histogram::take(uint64_t *counts, uint64_t &maxMicros, uint64_t &sumMicros) {
+    for(int i = 0; i < bucketCount; i++)
+        counts[i] = buckets[i].exchange(0, memory_order_relaxed);
+    maxMicros = maxSample.exchange(0, memory_order_relaxed);
+    sumMicros = sum.exchange(0, memory_order_relaxed);
+}
+
+latency_summary latency_histogram::summarize(const uint64_t *counts, uint64_t maxMicros, uint64_t sumMicros) {
+    latency_summary summary;
+    for(int i = 0; i < bucketCount; i++)
+        summary.count += counts[i];
+    if(summary.count == 0)
+        return summary;
+
+    summary.mean = (double)sumMicros / (double)summary.count;
+    summary.max = maxMicros;
+
+    // nearest rank, the sample at rank ceil(p * count) is in the first bucket that reaches it
+    const double levels[3] = {0.5, 0.9, 0.99};
+    uint64_t *targets[3] = {&summary.p50, &summary.p90, &summary.p99};
+    uint64_t seen = 0;
+    int level = 0;
+    for(int i = 0; i < bucketCount && level < 3; i++) {
+        seen += counts[i];
+        while(level < 3 && (double)seen >= levels[level] * (double)summary.count) {
+            *targets[level] = min(bucketUpperBound(i), maxMicros);
+            level++;
+        }
+    }
+    return summary;
+}
@@ -0,0 +1,120 @@
+//
+// Per stage latency histograms, recorded lock free from the detection threads.
+//
+
+#ifndef ARUCO_TEST_LATENCY_STATS_H
+#define ARUCO_TEST_LATENCY_STATS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/**
+ * The stages of a frame, from the camera to the socket
+ */
+enum latency_stage {
+    STAGE_CAPTURE,
+    STAGE_CONVERT,
+    STAGE_DETECT,
+    STAGE_REFINE,
+    STAGE_INTERPOLATE,
+    STAGE_POSE,
+    STAGE_FILTER,
+    STAGE_SERIALIZE,
+    STAGE_SEND,
+    STAGE_COUNT
+};
+
+const char *latencyStageName(latency_stage stage);
+
+/**
+ * Summary of the samples of one stage, all durations in microseconds
+ */
+struct latency_summary {
+    uint64_t count = 0;
+    double mean = 0;
+    uint64_t p50 = 0, p90 = 0, p99 = 0, max = 0;
+};
+
+/**
+ * Log linear histogram of durations in microseconds. Below 8us every value has its own bucket, above
+ * that each power of two is split into 8 buckets, so a percentile is off by at most 12.5%.
+ * record() is a couple of relaxed atomic adds and never blocks, any number of threads may record
+ * while one reader takes the counts.
+ */
+class latency_histogram {
+public:
+    static const int subBuckets = 8;
+    // 2^36us is almost a day, longer durations land in the last bucket
+    static const int maxExponent = 36;
+    static const int bucketCount = subBuckets * (maxExponent - 2);
+
+    latency_histogram();
+
+    void record(uint64_t micros);
+
+    /**
+     * Move the samples recorded since the last take into counts and start over from zero
+     *
+     * @param counts bucketCount entries
+     * @param maxMicros largest sample since the last take
+     * @param sumMicros sum of the samples since the last take
+     */
+    void take(uint64_t *counts, uint64_t &maxMicros, uint64_t &sumMicros);
+
+    static int bucketOf(uint64_t micros);
+
+    /** Largest value that falls into a bucket */
+    static uint64_t bucketUpperBound(int bucket);
+
+    /**
+     * Percentiles of bucket counts, each reported as its bucket's upper bound capped by the maximum
+     */
+    static latency_summary summarize(const uint64_t *counts, uint64_t maxMicros, uint64_t sumMicros);
+
+private:
+    std::atomic<uint64_t> buckets[bucketCount];
+    std::atomic<uint64_t> maxSample;
+    std::atomic<uint64_t> sum;
+};
+
+/**
+ * One histogram per stage, shared by everything that processes frames
+ */
+class stage_latencies {
+public:
+    void record(latency_stage stage, uint64_t micros) { histograms[stage].record(micros); }
+
+    latency_histogram &histogram(latency_stage stage) { return histograms[stage]; }
+
+private:
+    latency_histogram histograms[STAGE_COUNT];
+};
+
+/**
+ * Records the time from construction to stop() or destruction, does nothing without latencies
+ */
+class stage_timer {
+public:
+    stage_timer(stage_latencies *latencies, latency_stage stage)
+            : latencies(latencies), stage(stage), start(std::chrono::steady_clock::now()) {}
+
+    ~stage_timer() { stop(); }
+
+    void stop() {
+        if(latencies == nullptr)
+            return;
+        std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+        latencies->record(stage, (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+        latencies = nullptr;
+    }
+
+private:
+    stage_latencies *latencies;
+    latency_stage stage;
+    std::chrono::steady_clock::time_point start;
+};
+
+
+#endif //ARUCO_TEST_LATENCY_STATS_H
@@ -0,0 +1,344 @@
+#include "marker_detector.h"
+
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+
+using namespace std;
+using namespace cv;
+
+namespace {
+
+    /**
+     * Keep the contours of a thresholded image that look like a marker, same tests as the aruco
+     * module: perimeter range, convex quadrilateral, corner spacing and distance to the border
+     */
+    void findMarkerContours(const Mat &thresh, const Ptr<aruco::DetectorParameters> &params,
+                            vector< vector< Point2f > > &candidates, vector< vector< Point > > &contoursOut) {
+        int maxSize = max(thresh.cols, thresh.rows);
+        unsigned int minPerimeterPixels = (unsigned int)(params->minMarkerPerimeterRate * maxSize);
+        unsigned int maxPerimeterPixels = (unsigned int)(params->maxMarkerPerimeterRate * maxSize);
+
+        candidates.clear();
+        contoursOut.clear();
+
+        // the thresholded image is not used again, so unlike the aruco module it is not copied first
+        vector< vector< Point > > contours;
+        findContours(thresh, contours, RETR_LIST, CHAIN_APPROX_NONE);
+
+        vector< Point > approxCurve;
+        for(size_t i = 0; i < contours.size(); i++) {
+            if(contours[i].size() < minPerimeterPixels || contours[i].size() > maxPerimeterPixels)
+                continue;
+
+            approxPolyDP(contours[i], approxCurve, double(contours[i].size()) * params->polygonalApproxAccuracyRate,
+                         true);
+            if(approxCurve.size() != 4 || !isContourConvex(approxCurve))
+                continue;
+
+            double minDistSq = (double)maxSize * maxSize;
+            for(int j = 0; j < 4; j++) {
+                double dx = (double)(approxCurve[j].x - approxCurve[(j + 1) % 4].x);
+                double dy = (double)(approxCurve[j].y - approxCurve[(j + 1) % 4].y);
+                minDistSq = min(minDistSq, dx * dx + dy * dy);
+            }
+            double minCornerDistancePixels = double(contours[i].size()) * params->minCornerDistanceRate;
+            if(minDistSq < minCornerDistancePixels * minCornerDistancePixels)
+                continue;
+
+            bool tooNearBorder = false;
+            for(int j = 0; j < 4; j++) {
+                if(approxCurve[j].x < params->minDistanceToBorder || approxCurve[j].y < params->minDistanceToBorder ||
+                   approxCurve[j].x > thresh.cols - 1 - params->minDistanceToBorder ||
+                   approxCurve[j].y > thresh.rows - 1 - params->minDistanceToBorder)
+                    tooNearBorder = true;
+            }
+            if(tooNearBorder)
+                continue;
+
+            vector< Point2f > candidate(4);
+            for(int j = 0; j < 4; j++)
+                candidate[j] = Point2f((float)approxCurve[j].x, (float)approxCurve[j].y);
+            candidates.push_back(candidate);
+            contoursOut.push_back(contours[i]);
+        }
+    }
+
+    /**
+     * Make every candidate's corners clockwise
+     */
+    void reorderCandidatesCorners(vector< vector< Point2f > > &candidates) {
+        for(size_t i = 0; i < candidates.size(); i++) {
+            double dx1 = candidates[i][1].x - candidates[i][0].x;
+            double dy1 = candidates[i][1].y - candidates[i][0].y;
+            double dx2 = candidates[i][2].x - candidates[i][0].x;
+            double dy2 = candidates[i][2].y - candidates[i][0].y;
+            if((dx1 * dy2) - (dy1 * dx2) < 0.0)
+                swap(candidates[i][1], candidates[i][3]);
+        }
+    }
+
+    /**
+     * The inner and outer contour of a marker border, or the same square found at several window
+     * sizes, give near identical candidates. Of each close pair only the one with the longer contour stays.
+     */
+    void filterTooCloseCandidates(vector< vector< Point2f > > &candidates, vector< vector< Point > > &contours,
+                                  double minMarkerDistanceRate) {
+        vector< bool > toRemove(candidates.size(), false);
+        for(size_t i = 0; i < candidates.size(); i++) {
+            for(size_t j = i + 1; j < candidates.size(); j++) {
+                int minimumPerimeter = min((int)contours[i].size(), (int)contours[j].size());
+                double minMarkerDistancePixels = double(minimumPerimeter) * minMarkerDistanceRate;
+
+                // any corner of one candidate may correspond to the first corner of the other
+                bool tooClose = false;
+                for(int fc = 0; fc < 4 && !tooClose; fc++) {
+                    double distSq = 0;
+                    for(int c = 0; c < 4; c++) {
+                        double dx = candidates[i][(c + fc) % 4].x - candidates[j][c].x;
+                        double dy = candidates[i][(c + fc) % 4].y - candidates[j][c].y;
+                        distSq += dx * dx + dy * dy;
+                    }
+                    tooClose = distSq / 4. < minMarkerDistancePixels * minMarkerDistancePixels;
+                }
+                if(!tooClose || toRemove[i] || toRemove[j])
+                    continue;
+
+                if(contours[i].size() > contours[j].size())
+                    toRemove[j] = true;
+                else
+                    toRemove[i] = true;
+            }
+        }
+
+        size_t kept = 0;
+        for(size_t i = 0; i < candidates.size(); i++) {
+            if(toRemove[i])
+                continue;
+            if(kept != i) {
+                candidates[kept].swap(candidates[i]);
+                contours[kept].swap(contours[i]);
+            }
+            kept++;
+        }
+        candidates.resize(kept);
+        contours.resize(kept);
+    }
+
+    /**
+     * Remove the perspective of a candidate and read one bit per cell, borders included
+     */
+    Mat extractBits(const Mat &grey, const vector< Point2f > &corners, int markerSize, int markerBorderBits,
+                    int cellSize, double cellMarginRate, double minStdDevOtsu) {
+        int markerSizeWithBorders = markerSize + 2 * markerBorderBits;
+        int cellMarginPixels = int(cellMarginRate * cellSize);
+        int resultImgSize = markerSizeWithBorders * cellSize;
+
+        Point2f resultImgCorners[4] = {Point2f(0, 0), Point2f((float)resultImgSize - 1, 0),
+                                       Point2f((float)resultImgSize - 1, (float)resultImgSize - 1),
+                                       Point2f(0, (float)resultImgSize - 1)};
+        Mat transformation = getPerspectiveTransform(corners.data(), resultImgCorners);
+        Mat resultImg;
+        warpPerspective(grey, resultImg, transformation, Size(resultImgSize, resultImgSize), INTER_NEAREST);
+
+        Mat bits(markerSizeWithBorders, markerSizeWithBorders, CV_8UC1, Scalar::all(0));
+
+        // too little contrast for Otsu means all cells have the same color, skip the outer half cell
+        // where the perspective removal is noisy
+        Mat innerRegion = resultImg.colRange(cellSize / 2, resultImg.cols - cellSize / 2)
+                .rowRange(cellSize / 2, resultImg.rows - cellSize / 2);
+        Scalar mean, stddev;
+        meanStdDev(innerRegion, mean, stddev);
+        if(stddev[0] < minStdDevOtsu) {
+            if(mean[0] > 127)
+                bits.setTo(1);
+            return bits;
+        }
+
+        threshold(resultImg, resultImg, 125, 255, THRESH_BINARY | THRESH_OTSU);
+
+        for(int y = 0; y < markerSizeWithBorders; y++) {
+            for(int x = 0; x < markerSizeWithBorders; x++) {
+                Mat square = resultImg(Rect(x * cellSize + cellMarginPixels, y * cellSize + cellMarginPixels,
+                                            cellSize - 2 * cellMarginPixels, cellSize - 2 * cellMarginPixels));
+                if((size_t)countNonZero(square) > square.total() / 2)
+                    bits.at< uchar >(y, x) = 1;
+            }
+        }
+        return bits;
+    }
+
+    /**
+     * Number of border cells that are not black
+     */
+    int getBorderErrors(const Mat &bits, int markerSize, int borderSize) {
+        int sizeWithBorders = markerSize + 2 * borderSize;
+        int totalErrors = 0;
+        for(int y = 0; y < sizeWithBorders; y++) {
+            for(int k = 0; k < borderSize; k++) {
+                if(bits.ptr< uchar >(y)[k] != 0) totalErrors++;
+                if(bits.ptr< uchar >(y)[sizeWithBorders - 1 - k] != 0) totalErrors++;
+            }
+        }
+        for(int x = borderSize; x < sizeWithBorders - borderSize; x++) {
+            for(int k = 0; k < borderSize; k++) {
+                if(bits.ptr< uchar >(k)[x] != 0) totalErrors++;
+                if(bits.ptr< uchar >(sizeWithBorders - 1 - k)[x] != 0) totalErrors++;
+            }
+        }
+        return totalErrors;
+    }
+
+    /**
+     * Decode one candidate, on success its corners are rotated so the first one is the marker's top left
+     *
+     * @return the marker id or -1
+     */
+    int identifyOneCandidate(const Ptr<aruco::Dictionary> &dictionary, const dictionary_index *index,
+                             const bit_decoder *decoder, const Mat &grey, vector< Point2f > &corners,
+                             const Ptr<aruco::DetectorParameters> &params) {
+        int maximumErrorsInBorder =
+                int(dictionary->markerSize * dictionary->markerSize * params->maxErroneousBitsInBorderRate);
+        int id, rotation;
+
+        if(index != nullptr && decoder != nullptr) {
+            uint64_t code;
+            int borderErrors;
+            if(!decoder->decode(grey, corners, *params, code, borderErrors) || borderErrors > maximumErrorsInBorder ||
+               !index->identify(code, id, rotation))
+                return -1;
+            if(rotation != 0)
+                std::rotate(corners.begin(), corners.begin() + 4 - rotation, corners.end());
+            return id;
+        }
+
+        Mat candidateBits = extractBits(grey, corners, dictionary->markerSize, params->markerBorderBits,
+                                        params->perspectiveRemovePixelPerCell,
+                                        params->perspectiveRemoveIgnoredMarginPerCell, params->minOtsuStdDev);
+        if(getBorderErrors(candidateBits, dictionary->markerSize, params->markerBorderBits) > maximumErrorsInBorder)
+            return -1;
+
+        if(index != nullptr) {
+            uint64_t code = dictionary_index::packBits(candidateBits, dictionary->markerSize,
+                                                       params->markerBorderBits);
+            if(!index->identify(code, id, rotation))
+                return -1;
+        } else {
+            int border = params->markerBorderBits;
+            Mat onlyBits = candidateBits.rowRange(border, candidateBits.rows - border)
+                    .colRange(border, candidateBits.cols - border);
+            if(!dictionary->identify(onlyBits, id, rotation, params->errorCorrectionRate))
+                return -1;
+        }
+
+        if(rotation != 0)
+            std::rotate(corners.begin(), corners.begin() + 4 - rotation, corners.end());
+        return id;
+    }
+}
+
+marker_detector::marker_detector(const detector_options &options)
+        : integralThreshold(options.integralThreshold) {}
+
+void marker_detector::prepare(const Ptr<aruco::Dictionary> &dictionary, const aruco::DetectorParameters &params) {
+    if(!integralThreshold)
+        return;
+    // the index is built once per dictionary, its chunk tables again only when the tolerance changes
+    if(!dictionary_index::supports(*dictionary))
+        index.release();
+    else if(!index || index->indexedDictionary().get() != dictionary.get())
+        index = makePtr<dictionary_index>(dictionary);
+    if(index)
+        index->prepare(int(double(dictionary->maxCorrectionBits) * params.errorCorrectionRate));
+    if(!decoder || decoder->markerSize() != dictionary->markerSize || decoder->borderBits() != params.markerBorderBits)
+        decoder = bit_decoder::create(dictionary->markerSize, params.markerBorderBits);
+}
+
+void marker_detector::detect(const Mat &image, const Ptr<aruco::Dictionary> &dictionary,
+                             const Ptr<aruco::DetectorParameters> &params,
+                             vector< vector< Point2f > > &corners, vector< int > &ids,
+                             vector< vector< Point2f > > *rejected) {
+    bool supportedRefinement = params->cornerRefinementMethod == aruco::CORNER_REFINE_NONE ||
+                               params->cornerRefinementMethod == aruco::CORNER_REFINE_SUBPIX;
+    if(!integralThreshold || !supportedRefinement) {
+        if(rejected != nullptr)
+            aruco::detectMarkers(image, dictionary, corners, ids, params, *rejected);
+        else
+            aruco::detectMarkers(image, dictionary, corners, ids, params);
+        return;
+    }
+
+    // grey only ever owns the converted copy, a grey input is used as is
+    Mat frameGrey = image;
+    if(image.channels() == 3) {
+        cvtColor(image, grey, COLOR_BGR2GRAY);
+        frameGrey = grey;
+    }
+
+    // the window sweep of the aruco module, all thresholded in one pass
+    winSizes.clear();
+    int nScales = (params->adaptiveThreshWinSizeMax - params->adaptiveThreshWinSizeMin) /
+                  params->adaptiveThreshWinSizeStep + 1;
+    for(int i = 0; i < nScales; i++) {
+        int winSize = params->adaptiveThreshWinSizeMin + i * params->adaptiveThreshWinSizeStep;
+        winSizes.push_back(winSize % 2 == 0 ? winSize + 1 : winSize);
+    }
+    thresholder.apply(frameGrey, winSizes, params->adaptiveThreshConstant, thresholded);
+
+    detectCandidates(params);
+
+    prepare(dictionary, *params);
+    const dictionary_index *frameIndex = index.get();
+    const bit_decoder *frameDecoder = decoder.get();
+
+    candidateIds.assign(candidates.size(), -1);
+    parallel_for_(Range(0, (int)candidates.size()), [&](const Range &range) {
+        for(int i = range.start; i < range.end; i++)
+            candidateIds[i] = identifyOneCandidate(dictionary, frameIndex, frameDecoder, frameGrey, candidates[i],
+                                                   params);
+    });
+
+    corners.clear();
+    ids.clear();
+    if(rejected != nullptr)
+        rejected->clear();
+    for(size_t i = 0; i < candidates.size(); i++) {
+        if(candidateIds[i] >= 0) {
+            corners.push_back(candidates[i]);
+            ids.push_back(candidateIds[i]);
+        } else if(rejected != nullptr) {
+            rejected->push_back(candidates[i]);
+        }
+    }
+
+    if(params->cornerRefinementMethod == aruco::CORNER_REFINE_SUBPIX) {
+        TermCriteria criteria(TermCriteria::MAX_ITER | TermCriteria::EPS, params->cornerRefinementMaxIterations,
+                              params->cornerRefinementMinAccuracy);
+        Size winSize(params->cornerRefinementWinSize, params->cornerRefinementWinSize);
+        parallel_for_(Range(0, (int)corners.size()), [&](const Range &range) {
+            for(int i = range.start; i < range.end; i++)
+                cornerSubPix(frameGrey, corners[i], winSize, Size(-1, -1), criteria);
+        });
+    }
+}
+
+/**
+ * Contour search on every thresholded image, then corner ordering and removal of near duplicates
+ */
+void marker_detector::detectCandidates(const Ptr<aruco::DetectorParameters> &params) {
+    scaleCandidates.resize(thresholded.size());
+    scaleContours.resize(thresholded.size());
+    parallel_for_(Range(0, (int)thresholded.size()), [&](const Range &range) {
+        for(int i = range.start; i < range.end; i++)
+            findMarkerContours(thresholded[i], params, scaleCandidates[i], scaleContours[i]);
+    });
+
+    candidates.clear();
+    contours.clear();
+    for(size_t i = 0; i < thresholded.size(); i++) {
+        candidates.insert(candidates.end(), scaleCandidates[i].begin(), scaleCandidates[i].end());
+        contours.insert(contours.end(), scaleContours[i].begin(), scaleContours[i].end());
+    }
+
+    reorderCandidatesCorners(candidates);
+    filterTooCloseCandidates(candidates, contours, params->minMarkerDistanceRate);
+}
@@ -0,0 +1,63 @@
+//
+// Marker detection with our own threshold stage in front of the aruco candidate and decoding steps.
+//
+
+#ifndef ARUCO_TEST_MARKER_DETECTOR_H
+#define ARUCO_TEST_MARKER_DETECTOR_H
+
+#include <opencv2/aruco.hpp>
+#include <vector>
+#include "bit_decoder.h"
+#include "detector_params.h"
+#include "dictionary_index.h"
+#include "integral_threshold.h"
+
+/**
+ * Drop in for aruco::detectMarkers. With integralThreshold set, the steps of the aruco module are
+ * redone here so the adaptive threshold sweep can come from integral_threshold: candidate contours,
+ * corner ordering, removal of near duplicates, bit extraction and identification, then subpixel
+ * refinement. Otherwise, and for CORNER_REFINE_CONTOUR, it calls aruco::detectMarkers.
+ * Candidates are identified through a dictionary_index of the dictionary, their bits read by the
+ * bit_decoder compiled for its grid size. Both are built by prepare, or by the first frame that needs them.
+ */
+class marker_detector {
+public:
+    explicit marker_detector(const detector_options &options);
+
+    /**
+     * Same contract as aruco::detectMarkers
+     *
+     * @param rejected if not null, receives the candidates that did not decode to a marker
+     */
+    void detect(const cv::Mat &image, const cv::Ptr<cv::aruco::Dictionary> &dictionary,
+                const cv::Ptr<cv::aruco::DetectorParameters> &params,
+                std::vector< std::vector< cv::Point2f > > &corners, std::vector< int > &ids,
+                std::vector< std::vector< cv::Point2f > > *rejected = nullptr);
+
+    /**
+     * Build the dictionary index and choose the bit decoder for the dictionary and parameters now, so the
+     * first frame does not pay for them. Does nothing without integralThreshold.
+     */
+    void prepare(const cv::Ptr<cv::aruco::Dictionary> &dictionary, const cv::aruco::DetectorParameters &params);
+
+private:
+    void detectCandidates(const cv::Ptr<cv::aruco::DetectorParameters> &params);
+
+    bool integralThreshold;
+    integral_threshold thresholder;
+    cv::Ptr<dictionary_index> index;    // empty for dictionaries of more than 8x8 bits
+    cv::Ptr<bit_decoder> decoder;       // empty for grids without a compiled decoder
+
+    // buffers kept between frames
+    cv::Mat grey;
+    std::vector< int > winSizes;
+    std::vector< cv::Mat > thresholded;
+    std::vector< std::vector< std::vector< cv::Point2f > > > scaleCandidates;
+    std::vector< std::vector< std::vector< cv::Point > > > scaleContours;
+    std::vector< std::vector< cv::Point2f > > candidates;
+    std::vector< std::vector< cv::Point > > contours;
+    std::vector< int > candidateIds;
+};
+
+
+#endif //ARUCO_TEST_MARKER_DETECTOR_H
@@ -0,0 +1,41 @@
+#include "message_pool.h"
+
+#include <algorithm>
+
+using namespace std;
+
+message_pool::message_pool(size_t bufferCount) : slots(max((size_t)1, bufferCount)), fallbacks(0) {
+    freeSlots.reserve(slots.size());
+    for(size_t i = 0; i < slots.size(); i++) {
+        slots[i].pool = this;
+        freeSlots.push_back(&slots[i]);
+    }
+}
+
+void message_pool::acquire(zmq::message_t &message, size_t size) {
+    slot *free = nullptr;
+    {
+        lock_guard<std::mutex> lock(mutex);
+        if(!freeSlots.empty()) {
+            free = freeSlots.back();
+            freeSlots.pop_back();
+        }
+    }
+
+    if(free == nullptr) {
+        fallbacks.fetch_add(1, memory_order_relaxed);
+        message.rebuild(size);
+        return;
+    }
+
+    // the slot is ours until ZeroMQ releases it, growing it here cannot race with the I/O thread
+    if(free->data.size() < size)
+        free->data.resize(size);
+    message.rebuild(free->data.data(), size, &message_pool::release, free);
+}
+
+void message_pool::release(void *, void *hint) {
+    slot *released = static_cast<slot *>(hint);
+    lock_guard<std::mutex> lock(released->pool->mutex);
+    released->pool->freeSlots.push_back(released);
+}
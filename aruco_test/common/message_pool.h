@@ -0,0 +1,49 @@
+//
+// Fixed set of send buffers that ZeroMQ hands back when it is done with them.
+//
+
+#ifndef ARUCO_TEST_MESSAGE_POOL_H
+#define ARUCO_TEST_MESSAGE_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+#include <zmq.hpp>
+
+/**
+ * Messages are built on the buffers without copying, ZeroMQ calls back from its I/O thread once a
+ * message went out and the buffer is free again. A buffer only grows when a message is larger than any
+ * before it, so after the first few frames sending allocates nothing. When every buffer is still in
+ * flight the message falls back to one ZeroMQ allocates itself.
+ *
+ * The pool has to outlive every socket its messages were sent on, create it before the zmq::context_t.
+ */
+class message_pool {
+public:
+    explicit message_pool(size_t bufferCount = 4);
+
+    /**
+     * Make message a size byte message, on a pooled buffer when one is free
+     */
+    void acquire(zmq::message_t &message, size_t size);
+
+    /** Messages that did not get a pooled buffer */
+    size_t fallbackCount() const { return fallbacks.load(std::memory_order_relaxed); }
+
+private:
+    struct slot {
+        message_pool *pool;
+        std::vector< char > data;
+    };
+
+    static void release(void *data, void *hint);
+
+    std::vector< slot > slots;
+    std::mutex mutex;
+    std::vector< slot * > freeSlots;
+    std::atomic<size_t> fallbacks;
+};
+
+
+#endif //ARUCO_TEST_MESSAGE_POOL_H
@@ -0,0 +1,138 @@
+#include "parameter_controller.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    // a threshold window of about two cells always spans black and white bits of the marker
+    const double windowCells = 2.0;
+
+    double perimeterOf(const vector< Point2f > &corners) {
+        double perimeter = 0;
+        for(size_t i = 0; i < corners.size(); i++) {
+            Point2f edge = corners[(i + 1) % corners.size()] - corners[i];
+            perimeter += sqrt((double)edge.x * edge.x + (double)edge.y * edge.y);
+        }
+        return perimeter;
+    }
+
+    /**
+     * Twice the grey level standard deviation over the marker's bounding box, the black to white step
+     * for a marker with as many black as white pixels
+     */
+    double contrastOf(const Mat &grey, const vector< Point2f > &corners) {
+        Rect box = boundingRect(corners) & Rect(0, 0, grey.cols, grey.rows);
+        if(box.area() == 0)
+            return 0;
+        Scalar mean, deviation;
+        meanStdDev(grey(box), mean, deviation);
+        return 2 * deviation[0];
+    }
+}
+
+parameter_controller::parameter_controller(const aruco::DetectorParameters &base, int markerSize,
+                                           const adaptive_options &options)
+        : base(base), cellsPerSide(markerSize + 2 * base.markerBorderBits), options(options),
+          history(max(1, options.historyFrames)) {}
+
+void parameter_controller::reset() {
+    historyNext = 0;
+    historyCount = 0;
+    lastMarkers = 0;
+    markersDropped = true;
+    framesSinceProbe = 0;
+}
+
+void parameter_controller::restore(aruco::DetectorParameters &params) const {
+    params.minMarkerPerimeterRate = base.minMarkerPerimeterRate;
+    params.maxMarkerPerimeterRate = base.maxMarkerPerimeterRate;
+    params.adaptiveThreshWinSizeMin = base.adaptiveThreshWinSizeMin;
+    params.adaptiveThreshWinSizeMax = base.adaptiveThreshWinSizeMax;
+    params.adaptiveThreshWinSizeStep = base.adaptiveThreshWinSizeStep;
+    params.perspectiveRemovePixelPerCell = base.perspectiveRemovePixelPerCell;
+}
+
+void parameter_controller::apply(aruco::DetectorParameters &params) {
+    framesSinceProbe++;
+    lastNarrowed = false;
+    if(historyCount == 0 || markersDropped || framesSinceProbe >= options.probePeriod) {
+        framesSinceProbe = 0;
+        restore(params);
+        return;
+    }
+
+    frame_markers seen = history[(historyNext + history.size() - 1) % history.size()];
+    for(size_t i = 0; i < historyCount; i++) {
+        const frame_markers &frame = history[i];
+        seen.minPerimeterRate = min(seen.minPerimeterRate, frame.minPerimeterRate);
+        seen.maxPerimeterRate = max(seen.maxPerimeterRate, frame.maxPerimeterRate);
+        seen.minCell = min(seen.minCell, frame.minCell);
+        seen.maxCell = max(seen.maxCell, frame.maxCell);
+        seen.minContrast = min(seen.minContrast, frame.minContrast);
+    }
+
+    double minRate = max(base.minMarkerPerimeterRate, seen.minPerimeterRate * (1 - options.perimeterMargin));
+    double maxRate = min(base.maxMarkerPerimeterRate, seen.maxPerimeterRate * (1 + options.perimeterMargin));
+    if(minRate >= maxRate) {
+        // the markers seen lie outside the configured range, they came from a probe with other parameters
+        restore(params);
+        return;
+    }
+    params.minMarkerPerimeterRate = minRate;
+    params.maxMarkerPerimeterRate = maxRate;
+
+    // windows scale with the cells, the step is kept so low contrast markers get as many windows per
+    // cell size as before, high contrast ones only the two ends
+    int minWindow = base.adaptiveThreshWinSizeMin, maxWindow = base.adaptiveThreshWinSizeMax;
+    int low = min(max(cvRound(windowCells * seen.minCell), minWindow), maxWindow);
+    int high = min(max(cvRound(windowCells * seen.maxCell), low), maxWindow);
+    params.adaptiveThreshWinSizeMin = low;
+    params.adaptiveThreshWinSizeMax = high;
+    if(seen.minContrast >= options.highContrast)
+        params.adaptiveThreshWinSizeStep = max(1, high - low);
+    else
+        params.adaptiveThreshWinSizeStep = base.adaptiveThreshWinSizeStep;
+
+    // sampling the smallest marker's cells with more pixels than the image has only costs warp time
+    int pixelPerCell = max(options.minPixelPerCell, (int)ceil(seen.minCell));
+    params.perspectiveRemovePixelPerCell = min(pixelPerCell, base.perspectiveRemovePixelPerCell);
+
+    lastNarrowed = true;
+    narrowedCount++;
+}
+
+void parameter_controller::observe(const Mat &grey, const vector< vector< Point2f > > &corners) {
+    markersDropped = corners.size() < lastMarkers || corners.empty();
+    lastMarkers = corners.size();
+    if(corners.empty()) {
+        // the sizes seen before the markers were lost say nothing about where they come back
+        historyNext = 0;
+        historyCount = 0;
+        return;
+    }
+
+    double maxSize = max(grey.cols, grey.rows);
+    frame_markers &frame = history[historyNext];
+    for(size_t i = 0; i < corners.size(); i++) {
+        double perimeter = perimeterOf(corners[i]);
+        double rate = perimeter / maxSize;
+        double cell = perimeter / (4.0 * cellsPerSide);
+        double contrast = contrastOf(grey, corners[i]);
+        if(i == 0) {
+            frame.minPerimeterRate = frame.maxPerimeterRate = rate;
+            frame.minCell = frame.maxCell = cell;
+            frame.minContrast = contrast;
+            continue;
+        }
+        frame.minPerimeterRate = min(frame.minPerimeterRate, rate);
+        frame.maxPerimeterRate = max(frame.maxPerimeterRate, rate);
+        frame.minCell = min(frame.minCell, cell);
+        frame.maxCell = max(frame.maxCell, cell);
+        frame.minContrast = min(frame.minContrast, contrast);
+    }
+    historyNext = (historyNext + 1) % history.size();
+    historyCount = min(historyCount + 1, history.size());
+}
@@ -0,0 +1,84 @@
+//
+// Narrows the detector's size and threshold search to the markers of the last frames.
+//
+
+#ifndef ARUCO_TEST_PARAMETER_CONTROLLER_H
+#define ARUCO_TEST_PARAMETER_CONTROLLER_H
+
+#include <opencv2/aruco.hpp>
+#include <cstddef>
+#include <vector>
+
+struct adaptive_options {
+    // frames whose markers the ranges are fitted to
+    int historyFrames = 30;
+    // the perimeter range reaches this fraction below the smallest and above the largest perimeter seen
+    double perimeterMargin = 0.5;
+    // scan with the configured ranges at least once every this many frames, to find markers of other sizes
+    int probePeriod = 30;
+    // perspectiveRemovePixelPerCell is not lowered below this
+    int minPixelPerCell = 3;
+    // markers whose grey levels spread at least this much threshold cleanly, two windows are enough for them
+    double highContrast = 80;
+};
+
+/**
+ * Keeps the perimeter, contrast and cell size of the markers detected in the last frames and narrows
+ * minMarkerPerimeterRate, maxMarkerPerimeterRate, the adaptive threshold window sweep and
+ * perspectiveRemovePixelPerCell to them, never beyond the configured values. A frame with fewer markers
+ * than the one before, a frame without markers and every probePeriod-th frame scan with the configured
+ * ranges again, so lost markers and markers of new sizes are found.
+ */
+class parameter_controller {
+public:
+    /**
+     * @param base configured parameters, the widest ranges the controller uses
+     * @param markerSize bits per side of the dictionary's markers, without the border
+     */
+    parameter_controller(const cv::aruco::DetectorParameters &base, int markerSize, const adaptive_options &options);
+
+    /**
+     * Write the ranges for the next frame into params, every other field is left alone
+     */
+    void apply(cv::aruco::DetectorParameters &params);
+
+    /**
+     * Take the markers detected on the frame the last apply was for
+     *
+     * @param grey the frame the markers were detected on
+     */
+    void observe(const cv::Mat &grey, const std::vector< std::vector< cv::Point2f > > &corners);
+
+    /** Forget the markers seen, the next frame scans with the configured ranges */
+    void reset();
+
+    /** Whether the last apply narrowed the ranges */
+    bool narrowed() const { return lastNarrowed; }
+
+    /** Frames scanned with narrowed ranges */
+    size_t narrowedFrames() const { return narrowedCount; }
+
+private:
+    /** Extremes of the markers of one frame */
+    struct frame_markers {
+        double minPerimeterRate = 0, maxPerimeterRate = 0;   // perimeter over the larger image side
+        double minCell = 0, maxCell = 0;                     // cell side in pixels
+        double minContrast = 0;                              // twice the grey level deviation inside the marker
+    };
+
+    void restore(cv::aruco::DetectorParameters &params) const;
+
+    cv::aruco::DetectorParameters base;
+    int cellsPerSide;
+    adaptive_options options;
+    std::vector< frame_markers > history;   // ring of the last historyFrames frames with markers
+    size_t historyNext = 0, historyCount = 0;
+    size_t lastMarkers = 0;
+    bool markersDropped = true;
+    int framesSinceProbe = 0;
+    bool lastNarrowed = false;
+    size_t narrowedCount = 0;
+};
+
+
+#endif //ARUCO_TEST_PARAMETER_CONTROLLER_H
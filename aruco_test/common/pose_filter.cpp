@@ -0,0 +1,188 @@
+#include "pose_filter.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    /**
+     * A Rodrigues vector and the ones 2pi longer or shorter along the same axis are the same rotation,
+     * pick the one closest to the prediction so the filter does not see a jump when the angle wraps
+     */
+    Vec3d unwrapRotation(const Vec3d &measured, const Vec3d &predicted) {
+        double angle = norm(measured);
+        if(angle < 1e-9)
+            return measured;
+        Vec3d turn = measured * (2 * CV_PI / angle);
+        Vec3d best = measured;
+        double bestDistance = norm(measured - predicted);
+        for(int k = -1; k <= 1; k += 2) {
+            Vec3d candidate = measured + (double)k * turn;
+            double distance = norm(candidate - predicted);
+            if(distance < bestDistance) {
+                best = candidate;
+                bestDistance = distance;
+            }
+        }
+        return best;
+    }
+}
+
+pose_filter::pose_filter(const pose_filter_options &options)
+        : options(options), lastUs(0), frameIntervalUs(33333) {}
+
+void pose_filter::start(track &t, uint64_t captureUs, const Vec3d &rvec, const Vec3d &tvec) const {
+    t.stateUs = captureUs;
+    t.measuredUs = captureUs;
+    for(int i = 0; i < 6; i++) {
+        bool rotation = i >= 3;
+        double position = rotation ? rvec[i - 3] : tvec[i];
+        double measurement = rotation ? options.rotationMeasurement : options.translationMeasurement;
+        double velocity = rotation ? options.rotationVelocity : options.translationVelocity;
+        t.axes[i].x = Vec2d(position, 0);
+        t.axes[i].P = Matx22d(measurement * measurement, 0, 0, velocity * velocity);
+    }
+}
+
+/**
+ * x = F x, P = F P F' + Q with F = [1 dt; 0 1] and white noise acceleration
+ */
+void pose_filter::predictAxis(axis &a, double dt, double acceleration) const {
+    double q = acceleration * acceleration;
+    double dt2 = dt * dt;
+    a.x[0] += dt * a.x[1];
+    double p00 = a.P(0, 0) + dt * (a.P(0, 1) + a.P(1, 0)) + dt2 * a.P(1, 1) + q * dt2 * dt2 / 4;
+    double p01 = a.P(0, 1) + dt * a.P(1, 1) + q * dt2 * dt / 2;
+    double p11 = a.P(1, 1) + q * dt2;
+    a.P = Matx22d(p00, p01, p01, p11);
+}
+
+/**
+ * Position only measurement update of every axis, nothing is changed when one of the axes is gated out
+ */
+bool pose_filter::correct(track &t, const Vec3d &rvec, const Vec3d &tvec) const {
+    Vec3d predictedRvec(t.axes[3].x[0], t.axes[4].x[0], t.axes[5].x[0]);
+    Vec3d unwrapped = unwrapRotation(rvec, predictedRvec);
+
+    double innovations[6], variances[6];
+    for(int i = 0; i < 6; i++) {
+        bool rotation = i >= 3;
+        double z = rotation ? unwrapped[i - 3] : tvec[i];
+        double r = rotation ? options.rotationMeasurement : options.translationMeasurement;
+        innovations[i] = z - t.axes[i].x[0];
+        variances[i] = t.axes[i].P(0, 0) + r * r;
+        if(innovations[i] * innovations[i] > options.gate * options.gate * variances[i])
+            return false;
+    }
+
+    for(int i = 0; i < 6; i++) {
+        axis &a = t.axes[i];
+        double k0 = a.P(0, 0) / variances[i];
+        double k1 = a.P(1, 0) / variances[i];
+        a.x[0] += k0 * innovations[i];
+        a.x[1] += k1 * innovations[i];
+        double p00 = (1 - k0) * a.P(0, 0);
+        double p01 = (1 - k0) * a.P(0, 1);
+        double p11 = a.P(1, 1) - k1 * a.P(0, 1);
+        a.P = Matx22d(p00, p01, p01, p11);
+    }
+    return true;
+}
+
+tracked_pose pose_filter::state(const track &t, bool measured) const {
+    tracked_pose pose;
+    pose.id = t.id;
+    pose.measured = measured;
+    for(int i = 0; i < 3; i++) {
+        pose.tvec[i] = t.axes[i].x[0];
+        pose.tvecRate[i] = t.axes[i].x[1];
+        pose.rvec[i] = t.axes[i + 3].x[0];
+        pose.rvecRate[i] = t.axes[i + 3].x[1];
+    }
+    for(int i = 0; i < 6; i++)
+        pose.variance[i] = t.axes[i].P(0, 0);
+    return pose;
+}
+
+void pose_filter::update(uint64_t captureUs, const vector< int > &ids, const vector< Vec3d > &rvecs,
+                         const vector< Vec3d > &tvecs, vector< tracked_pose > &out) {
+    // smoothed frame interval, for predicting where the markers are in the next frame
+    if(lastUs != 0 && captureUs > lastUs)
+        frameIntervalUs += 0.1 * ((double)(captureUs - lastUs) - frameIntervalUs);
+    lastUs = captureUs;
+
+    for(size_t i = 0; i < tracks.size(); i++) {
+        track &t = tracks[i];
+        if(captureUs <= t.stateUs)
+            continue;
+        double dt = (double)(captureUs - t.stateUs) * 1e-6;
+        for(int a = 0; a < 6; a++)
+            predictAxis(t.axes[a], dt, a >= 3 ? options.rotationAcceleration : options.translationAcceleration);
+        t.stateUs = captureUs;
+    }
+
+    out.clear();
+    size_t count = min(ids.size(), min(rvecs.size(), tvecs.size()));
+    for(size_t m = 0; m < count; m++) {
+        // markers sharing an id can not be told apart, feeding them all to one track would average or
+        // restart it every frame. They go unfiltered and the id's track is left as it was.
+        if(std::count(ids.begin(), ids.begin() + count, ids[m]) > 1)
+            continue;
+        track *t = nullptr;
+        for(size_t i = 0; i < tracks.size(); i++) {
+            if(tracks[i].id == ids[m]) {
+                t = &tracks[i];
+                break;
+            }
+        }
+        if(t == nullptr) {
+            tracks.push_back(track());
+            t = &tracks.back();
+            t->id = ids[m];
+            start(*t, captureUs, rvecs[m], tvecs[m]);
+        } else if(correct(*t, rvecs[m], tvecs[m])) {
+            t->measuredUs = captureUs;
+        } else {
+            start(*t, captureUs, rvecs[m], tvecs[m]);
+        }
+        out.push_back(state(*t, true));
+    }
+
+    uint64_t coastUs = (uint64_t)(options.coastSeconds * 1e6);
+    for(size_t i = 0; i < tracks.size();) {
+        track &t = tracks[i];
+        if(t.measuredUs == captureUs) {
+            i++;
+            continue;
+        }
+        if(captureUs - t.measuredUs > coastUs) {
+            tracks[i] = tracks.back();
+            tracks.pop_back();
+            continue;
+        }
+        // an id seen several times is not lost, it just has no single pose to predict
+        if(std::count(ids.begin(), ids.begin() + count, t.id) > 1) {
+            i++;
+            continue;
+        }
+        out.push_back(state(t, false));
+        i++;
+    }
+}
+
+bool pose_filter::predict(int id, uint64_t atUs, Vec3d &rvec, Vec3d &tvec) const {
+    for(size_t i = 0; i < tracks.size(); i++) {
+        const track &t = tracks[i];
+        if(t.id != id)
+            continue;
+        double dt = atUs > t.stateUs ? (double)(atUs - t.stateUs) * 1e-6 : 0;
+        for(int a = 0; a < 3; a++) {
+            tvec[a] = t.axes[a].x[0] + dt * t.axes[a].x[1];
+            rvec[a] = t.axes[a + 3].x[0] + dt * t.axes[a + 3].x[1];
+        }
+        return true;
+    }
+    return false;
+}
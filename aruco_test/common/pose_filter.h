@@ -0,0 +1,96 @@
+//
+// Per id constant velocity Kalman filter on marker and board poses.
+//
+
+#ifndef ARUCO_TEST_POSE_FILTER_H
+#define ARUCO_TEST_POSE_FILTER_H
+
+#include <opencv2/core.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Noise model of the filter. Translations are in the units of the marker length, rotations in radians.
+ */
+struct pose_filter_options {
+    // standard deviation of the acceleration the constant velocity model does not explain, per second squared
+    double translationAcceleration = 2.0;
+    double rotationAcceleration = 10.0;
+    // standard deviation of a single frame's pose
+    double translationMeasurement = 0.005;
+    double rotationMeasurement = 0.02;
+    // standard deviation of the velocity of a newly seen id, per second
+    double translationVelocity = 1.0;
+    double rotationVelocity = 3.0;
+    // measurements this many standard deviations away from the prediction restart the track, the
+    // marker was moved while out of sight or the pose flipped to its mirrored solution
+    double gate = 6.0;
+    // an id that is not seen again keeps being predicted for this long
+    double coastSeconds = 0.2;
+};
+
+/**
+ * Filtered state of one id
+ */
+struct tracked_pose {
+    int id = 0;
+    cv::Vec3d rvec, tvec;           // filtered pose, or the prediction when the id was not measured
+    cv::Vec3d rvecRate, tvecRate;   // velocities, per second
+    cv::Vec6d variance;             // of x, y, z, rx, ry, rz
+    bool measured = false;          // false while coasting through a dropout
+};
+
+/**
+ * Keeps one track per marker id, or per board with id -1. Every axis of the translation and of the
+ * Rodrigues vector is an independent position and velocity filter, so a step is a handful of 2x2
+ * updates without allocating.
+ */
+class pose_filter {
+public:
+    explicit pose_filter(const pose_filter_options &options);
+
+    /**
+     * Step every track to the capture time, correct the tracks that were measured and start new ones
+     *
+     * @param captureUs monotonic capture time of the frame, in microseconds
+     * @param tracks receives every live track, the measured ones first in the order of ids. An id that
+     *               appears more than once is not filtered and its track is neither updated nor listed.
+     */
+    void update(uint64_t captureUs, const std::vector< int > &ids, const std::vector< cv::Vec3d > &rvecs,
+                const std::vector< cv::Vec3d > &tvecs, std::vector< tracked_pose > &tracks);
+
+    /**
+     * Pose of a track extrapolated to a time, false if the id is not tracked
+     */
+    bool predict(int id, uint64_t atUs, cv::Vec3d &rvec, cv::Vec3d &tvec) const;
+
+    /** Expected capture time of the next frame, from the average frame interval */
+    uint64_t nextFrameUs() const { return lastUs + (uint64_t)frameIntervalUs; }
+
+    void reset() { tracks.clear(); }
+
+private:
+    struct axis {
+        cv::Vec2d x;        // position, velocity
+        cv::Matx22d P;
+    };
+
+    struct track {
+        int id;
+        uint64_t stateUs, measuredUs;
+        axis axes[6];       // x, y, z, rx, ry, rz
+    };
+
+    void start(track &t, uint64_t captureUs, const cv::Vec3d &rvec, const cv::Vec3d &tvec) const;
+    void predictAxis(axis &a, double dt, double acceleration) const;
+    bool correct(track &t, const cv::Vec3d &rvec, const cv::Vec3d &tvec) const;
+    tracked_pose state(const track &t, bool measured) const;
+
+    pose_filter_options options;
+    std::vector< track > tracks;
+    uint64_t lastUs;
+    double frameIntervalUs;
+};
+
+
+#endif //ARUCO_TEST_POSE_FILTER_H
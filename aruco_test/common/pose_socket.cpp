@@ -0,0 +1,85 @@
+#include "pose_socket.h"
+
+#include <iostream>
+
+using namespace std;
+
+bool parseTransportMode(const string &name, transport_mode &mode) {
+    if(name == "pair")
+        mode = TRANSPORT_PAIR;
+    else if(name == "pub")
+        mode = TRANSPORT_PUB;
+    else if(name == "xpub")
+        mode = TRANSPORT_XPUB;
+    else
+        return false;
+    return true;
+}
+
+bool checkTransportOptions(const transport_options &options) {
+    if(options.endpoint.empty()) {
+        cerr << "No endpoint given" << endl;
+        return false;
+    }
+    if(options.highWaterMark < 0) {
+        cerr << "The high water mark can not be negative" << endl;
+        return false;
+    }
+    // libzmq only conflates PUB, PUSH, PULL, DEALER and SUB pipes and silently ignores the option otherwise
+    if(options.conflate && options.mode != TRANSPORT_PUB) {
+        cerr << "Conflation needs the pub transport" << endl;
+        return false;
+    }
+    return true;
+}
+
+pose_socket::pose_socket(zmq::context_t &context, const transport_options &options)
+        : options(options),
+          socket(context, options.mode == TRANSPORT_PAIR ? ZMQ_PAIR :
+                          options.mode == TRANSPORT_PUB ? ZMQ_PUB : ZMQ_XPUB),
+          subscribers(options.mode == TRANSPORT_XPUB ? 0 : -1) {
+    if(options.highWaterMark > 0)
+        socket.setsockopt(ZMQ_SNDHWM, &options.highWaterMark, sizeof(options.highWaterMark));
+    if(options.conflate) {
+        int conflate = 1;
+        socket.setsockopt(ZMQ_CONFLATE, &conflate, sizeof(conflate));
+    }
+    if(options.mode == TRANSPORT_XPUB) {
+        // pass on every subscriber's (un)subscription, not just the first and last one of each topic
+        int verbose = 1;
+#ifdef ZMQ_XPUB_VERBOSER
+        socket.setsockopt(ZMQ_XPUB_VERBOSER, &verbose, sizeof(verbose));
+#else
+        socket.setsockopt(ZMQ_XPUB_VERBOSE, &verbose, sizeof(verbose));
+#endif
+    }
+
+    if(options.mode == TRANSPORT_PAIR) {
+        cout << "Connecting to server " << options.endpoint << endl;
+        socket.connect(options.endpoint);
+    } else {
+        cout << "Publishing on " << options.endpoint << endl;
+        socket.bind(options.endpoint);
+    }
+}
+
+zmq::socket_t &pose_socket::sendSocket() {
+    if(options.mode == TRANSPORT_XPUB)
+        readSubscriptions();
+    return socket;
+}
+
+void pose_socket::readSubscriptions() {
+    // every message is one subscribe (first byte 1) or unsubscribe (first byte 0) followed by the topic
+    zmq::message_t message;
+    while(socket.recv(&message, ZMQ_DONTWAIT)) {
+        if(message.size() == 0)
+            continue;
+        const char *data = static_cast<const char *>(message.data());
+        if(data[0] == 1)
+            subscribers++;
+        else if(data[0] == 0 && subscribers > 0)
+            subscribers--;
+        cout << (data[0] == 1 ? "Subscribed" : "Unsubscribed") << ", " << subscribers << " subscribers" << endl;
+    }
+}
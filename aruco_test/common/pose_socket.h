@@ -0,0 +1,71 @@
+//
+// The socket the detectors send their frame messages on, one PAIR peer or any number of subscribers.
+//
+
+#ifndef ARUCO_TEST_POSE_SOCKET_H
+#define ARUCO_TEST_POSE_SOCKET_H
+
+#include <string>
+#include <zmq.hpp>
+
+/**
+ * How frame messages leave the detector
+ */
+enum transport_mode {
+    TRANSPORT_PAIR, // connect to the one zmqserver that binds, a slow reader blocks the detector
+    TRANSPORT_PUB,  // bind and fan out to every subscriber, a slow subscriber only loses its own messages
+    TRANSPORT_XPUB  // PUB that also reports subscribers joining and leaving
+};
+
+struct transport_options {
+    transport_mode mode = TRANSPORT_PAIR;
+    std::string endpoint = "tcp://0.0.0.0:5000";
+    // messages queued per peer, for PUB and XPUB each subscriber has its own queue, 0 keeps ZeroMQ's 1000
+    int highWaterMark = 0;
+    // PUB only, each subscriber's queue holds just the newest message so nobody reads a stale pose
+    bool conflate = false;
+};
+
+/**
+ * Parse "pair", "pub" or "xpub"
+ */
+bool parseTransportMode(const std::string &name, transport_mode &mode);
+
+/**
+ * Check the options fit together, printing what is wrong to cerr
+ */
+bool checkTransportOptions(const transport_options &options);
+
+/**
+ * Creates, configures and binds or connects the socket. Options are set before the socket is attached,
+ * ZeroMQ ignores the high water mark and conflation of pipes that already exist.
+ */
+class pose_socket {
+public:
+    /**
+     * @throws zmq::error_t when the endpoint can not be bound or connected
+     */
+    pose_socket(zmq::context_t &context, const transport_options &options);
+
+    /**
+     * The socket to send the next frame on. With XPUB the subscriptions that arrived since the last call
+     * are read first, ZeroMQ would otherwise keep queueing them.
+     */
+    zmq::socket_t &sendSocket();
+
+    /**
+     * Subscribers of an XPUB socket, -1 for the other modes. Without ZMQ_XPUB_VERBOSER, before libzmq 4.3,
+     * only the last subscriber to leave is seen leaving.
+     */
+    int subscriberCount() const { return subscribers; }
+
+private:
+    void readSubscriptions();
+
+    transport_options options;
+    zmq::socket_t socket;
+    int subscribers;
+};
+
+
+#endif //ARUCO_TEST_POSE_SOCKET_H
@@ -0,0 +1,64 @@
+#include "pyramid_detector.h"
+
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+
+using namespace std;
+using namespace cv;
+
+pyramid_detector::pyramid_detector(const detector_options &options)
+        : decimation(options.decimation), detector(options), coarseParams(aruco::DetectorParameters::create()) {}
+
+void pyramid_detector::detect(const Mat &image, const Ptr<aruco::Dictionary> &dictionary,
+                              const Ptr<aruco::DetectorParameters> &params,
+                              vector< vector< Point2f > > &corners, vector< int > &ids,
+                              vector< vector< Point2f > > *rejected) {
+    if(decimation <= 1) {
+        detector.detect(image, dictionary, params, corners, ids, rejected);
+        return;
+    }
+
+    // grey only ever owns the converted copy, a grey input is used as is
+    Mat frameGrey = image;
+    if(image.channels() == 3) {
+        cvtColor(image, grey, COLOR_BGR2GRAY);
+        frameGrey = grey;
+    }
+
+    // each pyrDown halves the frame, pixel i of the result is centered on pixel 2i of its source
+    pyrDown(frameGrey, half);
+    if(decimation == 4)
+        pyrDown(half, quarter);
+    const Mat &coarse = decimation == 4 ? quarter : half;
+
+    // window sizes and border distances are in pixels and shrink with the frame, the perimeter rates
+    // are relative to the frame size and stay as they are
+    *coarseParams = *params;
+    coarseParams->adaptiveThreshWinSizeMin = max(3, params->adaptiveThreshWinSizeMin / decimation);
+    coarseParams->adaptiveThreshWinSizeMax =
+            max(coarseParams->adaptiveThreshWinSizeMin, params->adaptiveThreshWinSizeMax / decimation);
+    coarseParams->adaptiveThreshWinSizeStep = max(1, params->adaptiveThreshWinSizeStep / decimation);
+    coarseParams->minDistanceToBorder = params->minDistanceToBorder / decimation;
+    coarseParams->cornerRefinementMethod = aruco::CORNER_REFINE_NONE;
+
+    detector.detect(coarse, dictionary, coarseParams, corners, ids, rejected);
+
+    float scale = (float)decimation;
+    for(size_t i = 0; i < corners.size(); i++) {
+        for(size_t c = 0; c < corners[i].size(); c++)
+            corners[i][c] *= scale;
+    }
+    if(rejected != nullptr) {
+        for(size_t i = 0; i < rejected->size(); i++) {
+            for(size_t c = 0; c < (*rejected)[i].size(); c++)
+                (*rejected)[i][c] *= scale;
+        }
+    }
+
+    // the coarse corners can be off by about one coarse pixel, the window has to reach that far
+    int winSize = max(params->cornerRefinementWinSize, 2 * decimation);
+    TermCriteria criteria(TermCriteria::MAX_ITER | TermCriteria::EPS, max(1, params->cornerRefinementMaxIterations),
+                          params->cornerRefinementMinAccuracy);
+    for(size_t i = 0; i < corners.size(); i++)
+        cornerSubPix(frameGrey, corners[i], Size(winSize, winSize), Size(-1, -1), criteria);
+}
@@ -0,0 +1,52 @@
+//
+// Coarse to fine marker detection, candidates on a decimated frame and corners at full resolution.
+//
+
+#ifndef ARUCO_TEST_PYRAMID_DETECTOR_H
+#define ARUCO_TEST_PYRAMID_DETECTOR_H
+
+#include <opencv2/aruco.hpp>
+#include <vector>
+#include "detector_params.h"
+#include "marker_detector.h"
+
+/**
+ * Thresholding and the contour search scale with the pixel count, so they run on a frame reduced by
+ * pyrDown to 1/2 or 1/4 size. Only the corners of the found markers go back to the full resolution
+ * grey image for cornerSubPix, which replaces the CORNER_REFINE_SUBPIX pass of the detector.
+ */
+class pyramid_detector {
+public:
+    /**
+     * @param options decimation is 1, 2 or 4, with 1 this is a plain marker_detector call
+     */
+    explicit pyramid_detector(const detector_options &options);
+
+    /**
+     * Same contract as aruco::detectMarkers, corners are in full resolution coordinates
+     *
+     * @param rejected if not null, receives the unrefined rejected candidates
+     */
+    void detect(const cv::Mat &image, const cv::Ptr<cv::aruco::Dictionary> &dictionary,
+                const cv::Ptr<cv::aruco::DetectorParameters> &params,
+                std::vector< std::vector< cv::Point2f > > &corners, std::vector< int > &ids,
+                std::vector< std::vector< cv::Point2f > > *rejected = nullptr);
+
+    /** See marker_detector::prepare */
+    void prepare(const cv::Ptr<cv::aruco::Dictionary> &dictionary, const cv::aruco::DetectorParameters &params) {
+        detector.prepare(dictionary, params);
+    }
+
+    int getDecimation() const { return decimation; }
+
+private:
+    int decimation;
+    marker_detector detector;
+
+    // buffers kept between frames
+    cv::Mat grey, half, quarter;
+    cv::Ptr<cv::aruco::DetectorParameters> coarseParams;
+};
+
+
+#endif //ARUCO_TEST_PYRAMID_DETECTOR_H
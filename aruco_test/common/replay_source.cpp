@@ -0,0 +1,42 @@
+#include "replay_source.h"
+
+#include <opencv2/imgcodecs.hpp>
+#include <sys/stat.h>
+#include <algorithm>
+
+using namespace std;
+using namespace cv;
+
+bool replay_source::open(const string &path) {
+    if(frame_log_reader::isFrameLog(path)) {
+        isLog = log.open(path);
+        return isLog;
+    }
+    struct stat info;
+    if(stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode)) {
+        glob(path, files, false);
+        sort(files.begin(), files.end());
+        return !files.empty();
+    }
+    return video.open(path);
+}
+
+bool replay_source::read(Mat &image, uint64_t &captureUs) {
+    if(isLog) {
+        capture_stamp stamp;
+        if(!log.next(stamp) || !log.frame(image))
+            return false;
+        captureUs = stamp.monotonicUs;
+        return true;
+    }
+    if(!video.isOpened()) {
+        // skip anything in the directory that is not an image
+        while(next < files.size()) {
+            image = imread(files[next++], IMREAD_COLOR);
+            if(!image.empty())
+                return true;
+        }
+        return false;
+    }
+    return video.grab() && video.retrieve(image);
+}
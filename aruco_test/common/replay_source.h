@@ -0,0 +1,37 @@
+//
+// Recorded footage read back frame by frame, for the benchmark and the parameter tuner.
+//
+
+#ifndef ARUCO_TEST_REPLAY_SOURCE_H
+#define ARUCO_TEST_REPLAY_SOURCE_H
+
+#include <opencv2/core.hpp>
+#include <opencv2/videoio.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "frame_log.h"
+
+/**
+ * Frames from a video file, from the images of a directory in name order, or from a frame log
+ */
+class replay_source {
+public:
+    bool open(const std::string &path);
+
+    /**
+     * @param captureUs receives the recorded capture time of a frame log's frames, kept for other sources
+     */
+    bool read(cv::Mat &image, uint64_t &captureUs);
+
+private:
+    cv::VideoCapture video;
+    std::vector< cv::String > files;
+    size_t next = 0;
+    frame_log_reader log;
+    bool isLog = false;
+};
+
+
+#endif //ARUCO_TEST_REPLAY_SOURCE_H
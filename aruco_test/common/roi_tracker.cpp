@@ -0,0 +1,188 @@
+#include "roi_tracker.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    // never pad less than this, so the corner refinement window and the border check fit in the region
+    const int minPaddingPixels = 12;
+    // corners of two detections closer than this in pixels are the same marker found twice
+    const float duplicateCornerDistance = 2.0f;
+
+    /**
+     * true when one of the markers found so far has its corners where these are, a second marker with
+     * the same id elsewhere in the frame is kept like detectMarkers keeps it
+     */
+    bool alreadyFound(const vector< vector< Point2f > > &corners, const vector< Point2f > &marker) {
+        float maxDistance2 = duplicateCornerDistance * duplicateCornerDistance;
+        for(size_t m = 0; m < corners.size(); m++) {
+            bool same = corners[m].size() == marker.size();
+            for(size_t c = 0; same && c < marker.size(); c++) {
+                Point2f d = corners[m][c] - marker[c];
+                same = d.x * d.x + d.y * d.y <= maxDistance2;
+            }
+            if(same)
+                return true;
+        }
+        return false;
+    }
+}
+
+roi_tracker::roi_tracker(int fullScanPeriod, float paddingRate, const detector_options &options)
+        : fullScanPeriod(max(1, fullScanPeriod)), paddingRate(paddingRate), framesSinceFullScan(0),
+          fullScanned(false), detector(options), trackedUs(0), predictedFromUs(0),
+          regionParams(aruco::DetectorParameters::create()) {}
+
+void roi_tracker::reset() {
+    trackedIds.clear();
+    trackedCorners.clear();
+    framesSinceFullScan = 0;
+    lock_guard<std::mutex> lock(predictionMutex);
+    predictedIds.clear();
+}
+
+void roi_tracker::setPredictedCorners(const vector< int > &ids, const vector< vector< Point2f > > &corners,
+                                      uint64_t fromUs) {
+    lock_guard<std::mutex> lock(predictionMutex);
+    predictedFromUs = fromUs;
+    predictedIds.assign(ids.begin(), ids.end());
+    // only grows, so the corner vectors keep their capacity when fewer markers are predicted
+    if(predictedCorners.size() < ids.size())
+        predictedCorners.resize(ids.size());
+    for(size_t i = 0; i < ids.size(); i++)
+        predictedCorners[i].assign(corners[i].begin(), corners[i].end());
+}
+
+void roi_tracker::detect(const Mat &image, const Ptr<aruco::Dictionary> &dictionary,
+                         const Ptr<aruco::DetectorParameters> &params,
+                         vector< vector< Point2f > > &corners, vector< int > &ids,
+                         vector< vector< Point2f > > *rejected, uint64_t captureUs) {
+    {
+        // each prediction is used once, and only for the frame right after the one it was made from. A
+        // prediction for an earlier frame would replace newer measured corners with an older guess.
+        lock_guard<std::mutex> lock(predictionMutex);
+        bool current = predictedFromUs == trackedUs;
+        for(size_t p = 0; current && p < predictedIds.size(); p++) {
+            // the filter has one pose per id, it can not tell markers sharing an id apart
+            if(count(trackedIds.begin(), trackedIds.end(), predictedIds[p]) > 1)
+                continue;
+            for(size_t i = 0; i < trackedIds.size(); i++) {
+                if(trackedIds[i] == predictedIds[p])
+                    trackedCorners[i].assign(predictedCorners[p].begin(), predictedCorners[p].end());
+            }
+        }
+        predictedIds.clear();
+    }
+
+    bool fullScan = trackedIds.empty() || framesSinceFullScan >= fullScanPeriod;
+
+    // a tracked marker that is not found in its region may have moved out of it, look everywhere
+    if(!fullScan && !scanRegions(image, dictionary, params, corners, ids, rejected))
+        fullScan = true;
+
+    if(fullScan) {
+        regions.clear();
+        if(fullScanDetector)
+            fullScanDetector->detect(image, dictionary, params, corners, ids, rejected);
+        else
+            detector.detect(image, dictionary, params, corners, ids, rejected);
+        framesSinceFullScan = 0;
+    }
+    framesSinceFullScan++;
+    fullScanned = fullScan;
+
+    trackedUs = captureUs;
+    trackedIds.assign(ids.begin(), ids.end());
+    trackedCorners.resize(corners.size());
+    for(size_t i = 0; i < corners.size(); i++)
+        trackedCorners[i].assign(corners[i].begin(), corners[i].end());
+}
+
+/**
+ * Grow the previous corners into padded rectangles, overlapping rectangles are merged so no pixel
+ * is scanned twice
+ */
+void roi_tracker::buildRegions(const Size &imageSize) {
+    Rect frame(Point(0, 0), imageSize);
+    regions.clear();
+
+    for(size_t i = 0; i < trackedCorners.size(); i++) {
+        Rect box = boundingRect(trackedCorners[i]);
+        int padding = max(minPaddingPixels, cvCeil(paddingRate * max(box.width, box.height)));
+        Rect region(box.x - padding, box.y - padding, box.width + 2 * padding, box.height + 2 * padding);
+        region &= frame;
+        if(region.area() == 0)
+            continue;
+
+        // keep merging until the region no longer touches any other one
+        for(size_t j = 0; j < regions.size();) {
+            if((region & regions[j]).area() > 0) {
+                region |= regions[j];
+                regions.erase(regions.begin() + j);
+                j = 0;
+            } else {
+                j++;
+            }
+        }
+        regions.push_back(region);
+    }
+}
+
+/**
+ * Detect inside each region and map the results back to frame coordinates
+ *
+ * @return false if one of the tracked markers was not found again
+ */
+bool roi_tracker::scanRegions(const Mat &image, const Ptr<aruco::Dictionary> &dictionary,
+                              const Ptr<aruco::DetectorParameters> &params,
+                              vector< vector< Point2f > > &corners, vector< int > &ids,
+                              vector< vector< Point2f > > *rejected) {
+    buildRegions(image.size());
+
+    corners.clear();
+    ids.clear();
+    if(rejected != nullptr)
+        rejected->clear();
+
+    int frameSize = max(image.cols, image.rows);
+    for(size_t r = 0; r < regions.size(); r++) {
+        const Rect &region = regions[r];
+        Point2f offset((float)region.x, (float)region.y);
+
+        // the perimeter rates are relative to the input size, rescale them so a crop accepts the
+        // same marker sizes in pixels as the full frame
+        *regionParams = *params;
+        float scale = (float)frameSize / (float)max(region.width, region.height);
+        regionParams->minMarkerPerimeterRate = params->minMarkerPerimeterRate * scale;
+        regionParams->maxMarkerPerimeterRate = params->maxMarkerPerimeterRate * scale;
+
+        detector.detect(image(region), dictionary, regionParams, regionCorners, regionIds,
+                        rejected != nullptr ? &regionRejected : nullptr);
+
+        for(size_t i = 0; i < regionIds.size(); i++) {
+            for(size_t c = 0; c < regionCorners[i].size(); c++)
+                regionCorners[i][c] += offset;
+            if(alreadyFound(corners, regionCorners[i]))
+                continue;
+            ids.push_back(regionIds[i]);
+            corners.push_back(regionCorners[i]);
+        }
+
+        if(rejected != nullptr) {
+            for(size_t i = 0; i < regionRejected.size(); i++) {
+                for(size_t c = 0; c < regionRejected[i].size(); c++)
+                    regionRejected[i][c] += offset;
+                rejected->push_back(regionRejected[i]);
+            }
+        }
+    }
+
+    // every tracked marker must be found again, as often as its id was tracked
+    for(size_t i = 0; i < trackedIds.size(); i++) {
+        if(count(ids.begin(), ids.end(), trackedIds[i]) < count(trackedIds.begin(), trackedIds.end(), trackedIds[i]))
+            return false;
+    }
+    return true;
+}
@@ -0,0 +1,109 @@
+//
+// Temporal region of interest tracking for aruco::detectMarkers.
+//
+
+#ifndef ARUCO_TEST_ROI_TRACKER_H
+#define ARUCO_TEST_ROI_TRACKER_H
+
+#include <opencv2/aruco.hpp>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "detector_params.h"
+#include "marker_detector.h"
+#include "pyramid_detector.h"
+
+/**
+ * Runs marker detection only on padded regions around the markers seen in the previous frame.
+ * The whole frame is scanned when nothing is tracked, every fullScanPeriod frames, and as soon as
+ * one of the tracked markers is not found again inside its region.
+ */
+class roi_tracker {
+public:
+    /**
+     * @param fullScanPeriod scan the whole frame at least once every this many frames
+     * @param paddingRate padding added on each side of a marker, as a fraction of its bounding box size
+     * @param options detection options used on the regions
+     */
+    roi_tracker(int fullScanPeriod, float paddingRate, const detector_options &options);
+
+    /**
+     * Same contract as aruco::detectMarkers, corners are always in full frame coordinates
+     *
+     * @param rejected if not null, receives the rejected candidates of the scanned area
+     * @param captureUs capture time of the frame, matches the frame to the predictions made from the one before
+     */
+    void detect(const cv::Mat &image, const cv::Ptr<cv::aruco::Dictionary> &dictionary,
+                const cv::Ptr<cv::aruco::DetectorParameters> &params,
+                std::vector< std::vector< cv::Point2f > > &corners, std::vector< int > &ids,
+                std::vector< std::vector< cv::Point2f > > *rejected = nullptr, uint64_t captureUs = 0);
+
+    /**
+     * Use a coarse to fine detector for the full frame scans instead of the region detector
+     */
+    void setFullScanDetector(const cv::Ptr<pyramid_detector> &detector) { fullScanDetector = detector; }
+
+    /** Prepare the region detector, see marker_detector::prepare */
+    void prepare(const cv::Ptr<cv::aruco::Dictionary> &dictionary, const cv::aruco::DetectorParameters &params) {
+        detector.prepare(dictionary, params);
+    }
+
+    /**
+     * Where the tracked markers are expected in the next frame, from a pose filter. The regions of the
+     * next scan are built around these corners instead of where the markers were last seen, so they follow
+     * fast moving markers that would otherwise leave their region and force a full scan. Ids that are not
+     * tracked are ignored. May be called from another thread than detect. The prediction is only used when
+     * the next frame detect scans is the one right after the frame it was made from, one that arrives after
+     * detect has moved past that frame, as in the pipeline, is dropped.
+     *
+     * @param corners one entry for each of ids, entries past them are ignored
+     * @param fromUs capture time of the frame the prediction was made from
+     */
+    void setPredictedCorners(const std::vector< int > &ids, const std::vector< std::vector< cv::Point2f > > &corners,
+                             uint64_t fromUs);
+
+    /**
+     * Forget all tracked markers so the next frame gets a full scan
+     */
+    void reset();
+
+    /** true if the last call to detect scanned the whole frame */
+    bool lastWasFullScan() const { return fullScanned; }
+
+    /** Regions scanned by the last call to detect, empty after a full scan */
+    const std::vector< cv::Rect > &lastRegions() const { return regions; }
+
+private:
+    void buildRegions(const cv::Size &imageSize);
+
+    bool scanRegions(const cv::Mat &image, const cv::Ptr<cv::aruco::Dictionary> &dictionary,
+                     const cv::Ptr<cv::aruco::DetectorParameters> &params,
+                     std::vector< std::vector< cv::Point2f > > &corners, std::vector< int > &ids,
+                     std::vector< std::vector< cv::Point2f > > *rejected);
+
+    int fullScanPeriod;
+    float paddingRate;
+    int framesSinceFullScan;
+    bool fullScanned;
+
+    marker_detector detector;
+    cv::Ptr<pyramid_detector> fullScanDetector;
+
+    std::vector< int > trackedIds;
+    std::vector< std::vector< cv::Point2f > > trackedCorners;
+    uint64_t trackedUs;     // capture time of the frame the tracked corners come from
+
+    std::mutex predictionMutex;
+    std::vector< int > predictedIds;
+    std::vector< std::vector< cv::Point2f > > predictedCorners;
+    uint64_t predictedFromUs;
+
+    // scratch buffers kept between frames
+    std::vector< cv::Rect > regions;
+    std::vector< int > regionIds;
+    std::vector< std::vector< cv::Point2f > > regionCorners, regionRejected;
+    cv::Ptr<cv::aruco::DetectorParameters> regionParams;
+};
+
+
+#endif //ARUCO_TEST_ROI_TRACKER_H
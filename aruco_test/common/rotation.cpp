@@ -0,0 +1,43 @@
+#include "rotation.h"
+
+#include <cmath>
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    // below this cos(pitch) the roll and yaw axes are taken to coincide
+    const double gimbalLockCos = 1e-9;
+}
+
+Vec4d rodriguesToQuaternion(const Vec3d &rvec) {
+    double angle = sqrt(rvec.dot(rvec));
+    // sin(angle / 2) / angle, by its series for tiny angles where the division loses everything
+    double scale = angle > 1e-8 ? sin(0.5 * angle) / angle : 0.5 - angle * angle / 48.0;
+    double w = cos(0.5 * angle);
+    if(w < 0) {
+        // a filtered rvec can grow past pi, -q is the same rotation
+        w = -w;
+        scale = -scale;
+    }
+    return Vec4d(w, scale * rvec[0], scale * rvec[1], scale * rvec[2]);
+}
+
+Matx33d quaternionToMatrix(const Vec4d &q) {
+    double w = q[0], x = q[1], y = q[2], z = q[3];
+    return Matx33d(1 - 2 * (y * y + z * z), 2 * (x * y - w * z), 2 * (x * z + w * y),
+                   2 * (x * y + w * z), 1 - 2 * (x * x + z * z), 2 * (y * z - w * x),
+                   2 * (x * z - w * y), 2 * (y * z + w * x), 1 - 2 * (x * x + y * y));
+}
+
+Vec3d quaternionToTaitBryan(const Vec4d &q) {
+    Matx33d R = quaternionToMatrix(q);
+    // atan2 keeps pitch accurate near +-pi/2, where asin(-R20) would not be
+    double cosPitch = sqrt(R(0, 0) * R(0, 0) + R(1, 0) * R(1, 0));
+    double pitch = atan2(-R(2, 0), cosPitch);
+    if(cosPitch < gimbalLockCos) {
+        // R only depends on yaw - roll or yaw + roll here, with roll 0 R01 and R11 are -sin(yaw) and cos(yaw)
+        return Vec3d(0, pitch, atan2(-R(0, 1), R(1, 1)));
+    }
+    return Vec3d(atan2(R(2, 1), R(2, 2)), pitch, atan2(R(1, 0), R(0, 0)));
+}
@@ -0,0 +1,33 @@
+//
+// Conversions between the rotation representations the detectors send, on fixed size types only.
+//
+
+#ifndef ARUCO_TEST_ROTATION_H
+#define ARUCO_TEST_ROTATION_H
+
+#include <opencv2/core.hpp>
+
+/**
+ * Unit quaternion of a Rodrigues vector, w first and w never negative, so every rotation has one quaternion
+ *
+ * @param rvec rotation axis times the angle in radians, as estimatePoseSingleMarkers gives it
+ * @return {w, x, y, z}
+ */
+cv::Vec4d rodriguesToQuaternion(const cv::Vec3d &rvec);
+
+/**
+ * Rotation matrix of a unit quaternion {w, x, y, z}
+ */
+cv::Matx33d quaternionToMatrix(const cv::Vec4d &q);
+
+/**
+ * Tait-Bryan angles of a unit quaternion {w, x, y, z}, in the z-y'-x'' order, so R = Rz(yaw) Ry(pitch) Rx(roll).
+ * Pitch is kept within [-pi/2, pi/2]. At a pitch of +-pi/2 roll and yaw turn about the same axis and only
+ * their sum or difference is defined, the gimbal lock, then the whole turn goes to yaw and roll is 0.
+ *
+ * @return {roll, pitch, yaw} in radians, the rotations about x, y and z
+ */
+cv::Vec3d quaternionToTaitBryan(const cv::Vec4d &q);
+
+
+#endif //ARUCO_TEST_ROTATION_H
@@ -0,0 +1,154 @@
+//
+// Bounded ring buffer connecting two pipeline stages, one producer thread and one consumer thread.
+//
+
+#ifndef ARUCO_TEST_SPSC_QUEUE_H
+#define ARUCO_TEST_SPSC_QUEUE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * What push does when the queue is full
+ */
+enum queue_policy {
+    QUEUE_BLOCK,        // wait until the consumer frees a slot
+    QUEUE_DROP_OLDEST   // throw away the oldest queued item and take its place
+};
+
+/**
+ * Parse "block" or "drop" into a queue policy
+ *
+ * @return false if the name is not a known policy
+ */
+inline bool parseQueuePolicy(const std::string &name, queue_policy &policy) {
+    if(name == "block") {
+        policy = QUEUE_BLOCK;
+        return true;
+    }
+    if(name == "drop") {
+        policy = QUEUE_DROP_OLDEST;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Fixed capacity FIFO between exactly one producer and one consumer. The slots are allocated once,
+ * items are moved in and out so Mats only change reference counts.
+ */
+template<typename T>
+class spsc_queue {
+public:
+    spsc_queue(size_t capacity, queue_policy policy)
+            : slots(capacity > 0 ? capacity : 1), policy(policy) {}
+
+    /**
+     * Queue an item, blocking or dropping the oldest item when full depending on the policy
+     *
+     * @return false if the queue was closed and the item was not queued
+     */
+    bool push(T &&item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if(policy == QUEUE_BLOCK)
+            notFull.wait(lock, [this] { return closed || count < slots.size(); });
+        if(closed)
+            return false;
+
+        if(count == slots.size()) {
+            slots[head] = T();
+            head = (head + 1) % slots.size();
+            count--;
+            dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        slots[(head + count) % slots.size()] = std::move(item);
+        count++;
+        depth.store(count, std::memory_order_relaxed);
+
+        lock.unlock();
+        notEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * Take the oldest item, waiting for one if the queue is empty
+     *
+     * @return false once the queue is closed and fully drained
+     */
+    bool pop(T &item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [this] { return closed || count > 0; });
+        if(count == 0)
+            return false;
+
+        item = std::move(slots[head]);
+        head = (head + 1) % slots.size();
+        count--;
+        depth.store(count, std::memory_order_relaxed);
+
+        lock.unlock();
+        notFull.notify_one();
+        return true;
+    }
+
+    /**
+     * Take the oldest item if there is one, without waiting
+     *
+     * @return false if the queue is empty
+     */
+    bool tryPop(T &item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if(count == 0)
+            return false;
+
+        item = std::move(slots[head]);
+        head = (head + 1) % slots.size();
+        count--;
+        depth.store(count, std::memory_order_relaxed);
+
+        lock.unlock();
+        notFull.notify_one();
+        return true;
+    }
+
+    /**
+     * Stop accepting items, the consumer still drains whatever is queued
+     */
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+        }
+        notEmpty.notify_all();
+        notFull.notify_all();
+    }
+
+    /** Number of queued items, safe to read from any thread */
+    size_t size() const { return depth.load(std::memory_order_relaxed); }
+
+    size_t capacity() const { return slots.size(); }
+
+    /** Number of items thrown away by QUEUE_DROP_OLDEST */
+    size_t droppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    std::vector<T> slots;
+    const queue_policy policy;
+
+    std::mutex mutex;
+    std::condition_variable notEmpty, notFull;
+    size_t head = 0;
+    size_t count = 0;
+    bool closed = false;
+
+    std::atomic<size_t> depth{0};
+    std::atomic<size_t> dropped{0};
+};
+
+
+#endif //ARUCO_TEST_SPSC_QUEUE_H
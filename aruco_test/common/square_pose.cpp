@@ -0,0 +1,175 @@
+#include "square_pose.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <opencv2/calib3d.hpp>
+
+using namespace std;
+using namespace cv;
+
+namespace {
+    /**
+     * Rotation that takes the unit vector along v to the z axis
+     */
+    Matx33d rotateToZAxis(const Vec3d &v) {
+        Vec3d a = v * (1.0 / norm(v));
+        double c = a[2];
+        if(fabs(1.0 + c) < FLT_EPSILON)
+            return Matx33d(1, 0, 0, 0, 1, 0, 0, 0, -1);
+        double d = 1.0 / (1.0 + c);
+        return Matx33d(1 - a[0] * a[0] * d, -a[0] * a[1] * d, -a[0],
+                       -a[0] * a[1] * d, 1 - a[1] * a[1] * d, -a[1],
+                       a[0], a[1], 1 - (a[0] * a[0] + a[1] * a[1]) * d);
+    }
+
+    /**
+     * The two rotations whose projection has jacobian J at the normalized point (p, q), IPPE's closed form
+     */
+    bool planeRotations(const Matx22d &J, double p, double q, Matx33d &R1, Matx33d &R2) {
+        Matx33d Rv = rotateToZAxis(Vec3d(p, q, 1)).t();
+
+        Matx22d B(Rv(0, 0) - p * Rv(2, 0), Rv(0, 1) - p * Rv(2, 1),
+                  Rv(1, 0) - q * Rv(2, 0), Rv(1, 1) - q * Rv(2, 1));
+        double det = B(0, 0) * B(1, 1) - B(0, 1) * B(1, 0);
+        if(fabs(det) < DBL_EPSILON)
+            return false;
+        Matx22d Binv(B(1, 1) / det, -B(0, 1) / det, -B(1, 0) / det, B(0, 0) / det);
+        Matx22d A = Binv * J;
+
+        // largest singular value of A
+        double ata00 = A(0, 0) * A(0, 0) + A(1, 0) * A(1, 0);
+        double ata01 = A(0, 0) * A(0, 1) + A(1, 0) * A(1, 1);
+        double ata11 = A(0, 1) * A(0, 1) + A(1, 1) * A(1, 1);
+        double gamma2 = 0.5 * (ata00 + ata11 + sqrt((ata00 - ata11) * (ata00 - ata11) + 4 * ata01 * ata01));
+        if(gamma2 < FLT_EPSILON)
+            return false;
+        Matx22d Rt = A * (1.0 / sqrt(gamma2));
+
+        // complete the 2x2 block to the rotations, the two signs of the third row are the ambiguity
+        double b0 = sqrt(max(0.0, 1 - Rt(0, 0) * Rt(0, 0) - Rt(1, 0) * Rt(1, 0)));
+        double b1 = sqrt(max(0.0, 1 - Rt(0, 1) * Rt(0, 1) - Rt(1, 1) * Rt(1, 1)));
+        if(-Rt(0, 0) * Rt(0, 1) - Rt(1, 0) * Rt(1, 1) < 0)
+            b1 = -b1;
+        double c = Rt(0, 0) * Rt(1, 1) - Rt(0, 1) * Rt(1, 0);
+
+        Matx33d S1(Rt(0, 0), Rt(0, 1), b1 * Rt(1, 0) - b0 * Rt(1, 1),
+                   Rt(1, 0), Rt(1, 1), b0 * Rt(0, 1) - b1 * Rt(0, 0),
+                   b0, b1, c);
+        Matx33d S2(Rt(0, 0), Rt(0, 1), b0 * Rt(1, 1) - b1 * Rt(1, 0),
+                   Rt(1, 0), Rt(1, 1), b1 * Rt(0, 0) - b0 * Rt(0, 1),
+                   -b0, -b1, c);
+        R1 = Rv * S1;
+        R2 = Rv * S2;
+        return true;
+    }
+
+    /**
+     * Least squares translation of the model points rotated by R onto the normalized image points
+     */
+    Vec3d planeTranslation(const Matx33d &R, const Point2d model[4], const Point2d image[4]) {
+        Matx33d AtA = Matx33d::zeros();
+        Vec3d Atb;
+        for(int k = 0; k < 4; k++) {
+            Vec3d X = R * Vec3d(model[k].x, model[k].y, 0);
+            double u = image[k].x, v = image[k].y;
+            // tx - u tz = u Xz - Xx and ty - v tz = v Xz - Xy
+            double bu = u * X[2] - X[0], bv = v * X[2] - X[1];
+            AtA(0, 0) += 1;
+            AtA(0, 2) -= u;
+            AtA(1, 1) += 1;
+            AtA(1, 2) -= v;
+            AtA(2, 2) += u * u + v * v;
+            Atb[0] += bu;
+            Atb[1] += bv;
+            Atb[2] -= u * bu + v * bv;
+        }
+        AtA(2, 0) = AtA(0, 2);
+        AtA(2, 1) = AtA(1, 2);
+        return AtA.solve(Atb, DECOMP_CHOLESKY);
+    }
+
+    double pixelError(const Matx33d &R, const Vec3d &t, const Point2d model[4], const Point2d image[4],
+                      const Vec2d &pixelScale) {
+        double sum = 0;
+        for(int k = 0; k < 4; k++) {
+            Vec3d X = R * Vec3d(model[k].x, model[k].y, 0) + t;
+            double dx = (X[0] / X[2] - image[k].x) * pixelScale[0];
+            double dy = (X[1] / X[2] - image[k].y) * pixelScale[1];
+            sum += dx * dx + dy * dy;
+        }
+        return sqrt(sum / 4);
+    }
+}
+
+void square_pose_solver::solveNormalized(const Point2d corners[4], double halfLength, const Vec2d &pixelScale,
+                                         square_pose &pose) {
+    pose.valid = false;
+    const Point2d model[4] = {Point2d(-halfLength, halfLength), Point2d(halfLength, halfLength),
+                              Point2d(halfLength, -halfLength), Point2d(-halfLength, -halfLength)};
+
+    // homography from the marker plane to the normalized image, h22 = 1
+    Matx< double, 8, 8 > A;
+    Matx< double, 8, 1 > b;
+    for(int k = 0; k < 4; k++) {
+        double X = model[k].x, Y = model[k].y, u = corners[k].x, v = corners[k].y;
+        double rowU[8] = {X, Y, 1, 0, 0, 0, -u * X, -u * Y};
+        double rowV[8] = {0, 0, 0, X, Y, 1, -v * X, -v * Y};
+        for(int j = 0; j < 8; j++) {
+            A(2 * k, j) = rowU[j];
+            A(2 * k + 1, j) = rowV[j];
+        }
+        b(2 * k) = u;
+        b(2 * k + 1) = v;
+    }
+    Matx< double, 8, 1 > h;
+    if(!cv::solve(A, b, h, DECOMP_LU))
+        return;
+
+    // the marker centre maps to (p, q), J is the homography's jacobian there
+    double p = h(2), q = h(5);
+    Matx22d J(h(0) - h(6) * p, h(1) - h(7) * p,
+              h(3) - h(6) * q, h(4) - h(7) * q);
+
+    Matx33d R[2];
+    if(!planeRotations(J, p, q, R[0], R[1]))
+        return;
+
+    for(int s = 0; s < 2; s++) {
+        pose.tvecs[s] = planeTranslation(R[s], model, corners);
+        pose.errors[s] = pixelError(R[s], pose.tvecs[s], model, corners, pixelScale);
+        Rodrigues(R[s], pose.rvecs[s]);
+    }
+    if(pose.errors[1] < pose.errors[0]) {
+        swap(pose.rvecs[0], pose.rvecs[1]);
+        swap(pose.tvecs[0], pose.tvecs[1]);
+        swap(pose.errors[0], pose.errors[1]);
+    }
+    pose.valid = true;
+}
+
+void square_pose_solver::solve(const vector< vector< Point2f > > &corners, float markerLength,
+                               const Mat &camMatrix, const Mat &distCoeffs, vector< square_pose > &poses) {
+    poses.resize(corners.size());
+    if(corners.empty())
+        return;
+
+    // one undistortPoints call for the whole frame
+    distorted.clear();
+    for(size_t i = 0; i < corners.size(); i++)
+        distorted.insert(distorted.end(), corners[i].begin(), corners[i].end());
+    undistortPoints(distorted, undistorted, camMatrix, distCoeffs);
+
+    Vec2d pixelScale(camMatrix.at< double >(0, 0), camMatrix.at< double >(1, 1));
+    double halfLength = markerLength / 2.0;
+    Point2d normalized[4];
+    for(size_t i = 0, offset = 0; i < corners.size(); offset += corners[i].size(), i++) {
+        if(corners[i].size() != 4) {
+            poses[i].valid = false;
+            continue;
+        }
+        for(int k = 0; k < 4; k++)
+            normalized[k] = Point2d(undistorted[offset + k].x, undistorted[offset + k].y);
+        solveNormalized(normalized, halfLength, pixelScale, poses[i]);
+    }
+}
@@ -0,0 +1,54 @@
+//
+// Closed form pose of a square marker from its four corners, both solutions of the planar ambiguity.
+//
+
+#ifndef ARUCO_TEST_SQUARE_POSE_H
+#define ARUCO_TEST_SQUARE_POSE_H
+
+#include <opencv2/core.hpp>
+#include <vector>
+
+/**
+ * The two poses that explain a square's corners, a marker seen at an angle is ambiguous between a pose
+ * and its mirror through the line of sight. Solution 0 has the lower error, when both errors are close
+ * the marker is too small or too frontal to tell them apart.
+ */
+struct square_pose {
+    cv::Vec3d rvecs[2], tvecs[2];
+    // RMS reprojection error in pixels of each solution, measured on the undistorted corners
+    double errors[2];
+    bool valid = false;     // false for corners no homography maps the square to
+};
+
+/**
+ * IPPE for squares (Collins and Bartoli, Infinitesimal Plane-based Pose Estimation): the homography of
+ * the square is solved in closed form, its jacobian at the marker centre gives both rotations without
+ * iterating, and each translation is a 3x3 least squares solve. Everything per marker is fixed size Matx
+ * math, the only buffers are the frame's corners in one array for a single undistortPoints call.
+ * Object points are those of estimatePoseSingleMarkers, so the poses can be used in its place.
+ */
+class square_pose_solver {
+public:
+    /**
+     * Solve every marker of a frame
+     *
+     * @param poses one entry per marker, in the order of corners
+     */
+    void solve(const std::vector< std::vector< cv::Point2f > > &corners, float markerLength,
+               const cv::Mat &camMatrix, const cv::Mat &distCoeffs, std::vector< square_pose > &poses);
+
+    /**
+     * Solve one marker from its corners in normalized camera coordinates, x / z and y / z
+     *
+     * @param pixelScale focal lengths, to express the errors in pixels
+     */
+    static void solveNormalized(const cv::Point2d corners[4], double halfLength, const cv::Vec2d &pixelScale,
+                                square_pose &pose);
+
+private:
+    // scratch buffers kept between frames
+    std::vector< cv::Point2f > distorted, undistorted;
+};
+
+
+#endif //ARUCO_TEST_SQUARE_POSE_H
@@ -0,0 +1,78 @@
+#include "stats_publisher.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+using namespace std;
+
+stats_publisher::stats_publisher(zmq::context_t &context, const string &endpoint, int periodMs,
+                                 stage_latencies &latencies)
+        : context(context), endpoint(endpoint), periodMs(max(1, periodMs)), latencies(latencies),
+          started(chrono::steady_clock::now()) {
+    for(int i = 0; i < STAGE_COUNT; i++)
+        totals[i] = 0;
+    thread = std::thread(&stats_publisher::run, this);
+}
+
+stats_publisher::~stats_publisher() {
+    {
+        lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    thread.join();
+}
+
+void stats_publisher::run() {
+    zmq::socket_t socket(context, ZMQ_PUB);
+    int linger = 0;
+    socket.setsockopt(ZMQ_LINGER, &linger, sizeof(linger));
+    try {
+        socket.bind(endpoint);
+    } catch(const zmq::error_t &e) {
+        cerr << "Could not bind stats endpoint " << endpoint << ": " << e.what() << endl;
+        return;
+    }
+
+    chrono::steady_clock::time_point last = chrono::steady_clock::now();
+    unique_lock<std::mutex> lock(mutex);
+    while(!wake.wait_for(lock, chrono::milliseconds(periodMs), [this] { return stopping; })) {
+        chrono::steady_clock::time_point now = chrono::steady_clock::now();
+        double intervalMs = chrono::duration<double, milli>(now - last).count();
+        last = now;
+
+        string text = snapshot(intervalMs);
+        zmq::message_t message(text.size());
+        memcpy(message.data(), text.data(), text.size());
+        socket.send(message, ZMQ_DONTWAIT);
+    }
+}
+
+string stats_publisher::snapshot(double intervalMs) {
+    double uptimeMs = chrono::duration<double, milli>(chrono::steady_clock::now() - started).count();
+
+    stringstream ss;
+    ss << "{\"uptimeMs\": " << (uint64_t)uptimeMs << ", \"intervalMs\": " << intervalMs << ", \"stages\": {";
+    bool first = true;
+    uint64_t counts[latency_histogram::bucketCount];
+    for(int i = 0; i < STAGE_COUNT; i++) {
+        latency_stage stage = (latency_stage)i;
+        uint64_t maxMicros, sumMicros;
+        latencies.histogram(stage).take(counts, maxMicros, sumMicros);
+        latency_summary summary = latency_histogram::summarize(counts, maxMicros, sumMicros);
+        totals[i] += summary.count;
+
+        // stages this detector never runs stay out of the message
+        if(totals[i] == 0)
+            continue;
+        ss << (first ? "" : ", ") << "\"" << latencyStageName(stage) << "\": {"
+           << "\"count\": " << summary.count << ", \"mean\": " << summary.mean
+           << ", \"p50\": " << summary.p50 << ", \"p90\": " << summary.p90 << ", \"p99\": " << summary.p99
+           << ", \"max\": " << summary.max << ", \"total\": " << totals[i] << "}";
+        first = false;
+    }
+    ss << "}}";
+    return ss.str();
+}
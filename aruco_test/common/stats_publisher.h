@@ -0,0 +1,51 @@
+//
+// Publishes stage latency snapshots on their own ZeroMQ socket, away from the pose socket.
+//
+
+#ifndef ARUCO_TEST_STATS_PUBLISHER_H
+#define ARUCO_TEST_STATS_PUBLISHER_H
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <zmq.hpp>
+#include "latency_stats.h"
+
+/**
+ * Every period a background thread takes the samples recorded since the last snapshot and sends one
+ * JSON message on a PUB socket, so any number of subscribers can watch a running detector. Each stage
+ * reports the interval's count, mean, p50, p90, p99 and max in microseconds plus its total count.
+ */
+class stats_publisher {
+public:
+    /**
+     * @param context the socket is created on the publisher thread, the context has to outlive this
+     * @param endpoint bind address, ex. "tcp://0.0.0.0:5001"
+     */
+    stats_publisher(zmq::context_t &context, const std::string &endpoint, int periodMs,
+                    stage_latencies &latencies);
+
+    ~stats_publisher();
+
+private:
+    void run();
+
+    std::string snapshot(double intervalMs);
+
+    zmq::context_t &context;
+    std::string endpoint;
+    int periodMs;
+    stage_latencies &latencies;
+
+    uint64_t totals[STAGE_COUNT];
+    std::chrono::steady_clock::time_point started;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping = false;
+    std::thread thread;
+};
+
+
+#endif //ARUCO_TEST_STATS_PUBLISHER_H
@@ -0,0 +1,70 @@
+#include "undistort_map.h"
+
+#include <algorithm>
+#include <cmath>
+#include <opencv2/calib3d.hpp>
+
+using namespace std;
+using namespace cv;
+
+const int undistort_map::defaultCellSize;
+
+undistort_map::undistort_map(const Mat &camMatrix, const Mat &distCoeffs, bool fisheye, int cellSize)
+        : camMatrix(camMatrix), distCoeffs(distCoeffs), fisheye(fisheye), cellSize(max(1, cellSize)),
+          columns(0), rows(0) {}
+
+void undistort_map::prepare(const Size &imageSize) {
+    if(imageSize == size)
+        return;
+    size = imageSize;
+
+    // one node past the last pixel on each side, so every pixel has four nodes around it
+    columns = (size.width - 1) / cellSize + 2;
+    rows = (size.height - 1) / cellSize + 2;
+    vector< Point2f > grid;
+    grid.reserve((size_t)columns * rows);
+    for(int r = 0; r < rows; r++)
+        for(int c = 0; c < columns; c++)
+            grid.push_back(Point2f((float)(c * cellSize), (float)(r * cellSize)));
+
+    // P = camMatrix gives pixels of the ideal camera instead of normalized coordinates
+    if(fisheye)
+        cv::fisheye::undistortPoints(grid, nodes, camMatrix, distCoeffs, noArray(), camMatrix);
+    else
+        undistortPoints(grid, nodes, camMatrix, distCoeffs, noArray(), camMatrix);
+}
+
+Point2f undistort_map::lookup(const Point2f &p) const {
+    float x = p.x / cellSize, y = p.y / cellSize;
+    int c = min(max((int)floor(x), 0), columns - 2);
+    int r = min(max((int)floor(y), 0), rows - 2);
+    float fx = x - c, fy = y - r;
+
+    const Point2f *top = &nodes[(size_t)r * columns + c];
+    const Point2f *bottom = top + columns;
+    Point2f upper = top[0] + (top[1] - top[0]) * fx;
+    Point2f lower = bottom[0] + (bottom[1] - bottom[0]) * fx;
+    return upper + (lower - upper) * fy;
+}
+
+void undistort_map::undistort(const vector< Point2f > &distorted, vector< Point2f > &ideal) const {
+    CV_Assert(!nodes.empty());
+    ideal.resize(distorted.size());
+    for(size_t i = 0; i < distorted.size(); i++)
+        ideal[i] = lookup(distorted[i]);
+}
+
+void undistort_map::undistort(const vector< vector< Point2f > > &distorted,
+                              vector< vector< Point2f > > &ideal) const {
+    ideal.resize(distorted.size());
+    for(size_t i = 0; i < distorted.size(); i++)
+        undistort(distorted[i], ideal[i]);
+}
+
+void undistort_map::project(const vector< Point3f > &objectPoints, const Vec3d &rvec, const Vec3d &tvec,
+                            vector< Point2f > &imagePoints) const {
+    if(fisheye)
+        cv::fisheye::projectPoints(objectPoints, imagePoints, rvec, tvec, camMatrix, distCoeffs);
+    else
+        projectPoints(objectPoints, rvec, tvec, camMatrix, distCoeffs, imagePoints);
+}
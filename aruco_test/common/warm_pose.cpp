@@ -0,0 +1,128 @@
+#include "warm_pose.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <opencv2/calib3d.hpp>
+
+using namespace std;
+using namespace cv;
+
+warm_pose_solver::warm_pose_solver(const warm_start_options &options)
+        : options(options), frame(0), warmCount(0), coldCount(0) {
+    this->options.maxIterations = max(1, options.maxIterations);
+}
+
+void warm_pose_solver::nextFrame() {
+    frame++;
+    for(size_t i = 0; i < guesses.size();) {
+        if(guesses[i].frame + 1 < frame) {
+            guesses[i] = guesses.back();
+            guesses.pop_back();
+        } else {
+            i++;
+        }
+    }
+}
+
+double warm_pose_solver::squaredError(const vector< Point2f > &imagePoints) const {
+    double sum = 0;
+    for(size_t i = 0; i < projected.size(); i++) {
+        Point2f d = imagePoints[i] - projected[i];
+        sum += d.x * d.x + d.y * d.y;
+    }
+    return sum;
+}
+
+bool warm_pose_solver::solve(int id, const vector< Point3f > &objectPoints, const vector< Point2f > &imagePoints,
+                             const Mat &camMatrix, const Mat &distCoeffs, Vec3d &rvec, Vec3d &tvec,
+                             double &error) {
+    const guess *previous = nullptr;
+    for(size_t i = 0; i < guesses.size(); i++) {
+        if(guesses[i].id == id && guesses[i].frame + 1 == frame) {
+            previous = &guesses[i];
+            break;
+        }
+    }
+    // below four points the pose is not determined, the cold solvers refuse too
+    if(previous == nullptr || objectPoints.size() < 4 || objectPoints.size() != imagePoints.size()) {
+        coldCount++;
+        return false;
+    }
+
+    rvec = previous->rvec;
+    tvec = previous->tvec;
+    Vec3d lastRvec = rvec, lastTvec = tvec;
+    double lastError = DBL_MAX, squared = 0;
+    int iterations = options.maxIterations;
+    for(int iteration = 0;; iteration++) {
+        // columns of the jacobian are rvec, tvec, focal lengths, principal point and distortion
+        projectPoints(objectPoints, rvec, tvec, camMatrix, distCoeffs, projected, jacobian);
+        squared = squaredError(imagePoints);
+        if(squared > lastError) {
+            // the step overshot, keep the pose before it
+            rvec = lastRvec;
+            tvec = lastTvec;
+            squared = lastError;
+            break;
+        }
+        if(iteration == iterations)
+            break;
+
+        Matx66d JtJ = Matx66d::zeros();
+        Matx61d Jtr = Matx61d::zeros();
+        for(size_t p = 0; p < projected.size(); p++) {
+            double residuals[2] = {imagePoints[p].x - projected[p].x, imagePoints[p].y - projected[p].y};
+            for(int r = 0; r < 2; r++) {
+                const double *row = jacobian.ptr<double>(2 * (int)p + r);
+                for(int i = 0; i < 6; i++) {
+                    Jtr(i) += row[i] * residuals[r];
+                    for(int j = i; j < 6; j++)
+                        JtJ(i, j) += row[i] * row[j];
+                }
+            }
+        }
+        for(int i = 0; i < 6; i++) {
+            for(int j = 0; j < i; j++)
+                JtJ(i, j) = JtJ(j, i);
+        }
+
+        Matx61d step = JtJ.solve(Jtr, DECOMP_CHOLESKY);
+        lastRvec = rvec;
+        lastTvec = tvec;
+        lastError = squared;
+        rvec += Vec3d(step(0), step(1), step(2));
+        tvec += Vec3d(step(3), step(4), step(5));
+
+        // converged, evaluate the last step and stop
+        if(norm(step) < 1e-8)
+            iterations = iteration + 1;
+    }
+
+    error = sqrt(squared / projected.size());
+    if(error > options.jumpRate * previous->error + options.jumpPixels) {
+        coldCount++;
+        return false;
+    }
+    warmCount++;
+    remember(id, rvec, tvec, error);
+    return true;
+}
+
+void warm_pose_solver::remember(int id, const Vec3d &rvec, const Vec3d &tvec, double error) {
+    guess *entry = nullptr;
+    for(size_t i = 0; i < guesses.size(); i++) {
+        if(guesses[i].id == id) {
+            entry = &guesses[i];
+            break;
+        }
+    }
+    if(entry == nullptr) {
+        guesses.push_back(guess());
+        entry = &guesses.back();
+        entry->id = id;
+    }
+    entry->frame = frame;
+    entry->rvec = rvec;
+    entry->tvec = tvec;
+    entry->error = error;
+}
@@ -0,0 +1,73 @@
+//
+// Pose solving seeded with the previous frame's pose of the same marker or board.
+//
+
+#ifndef ARUCO_TEST_WARM_POSE_H
+#define ARUCO_TEST_WARM_POSE_H
+
+#include <opencv2/core.hpp>
+#include <cstddef>
+#include <vector>
+
+struct warm_start_options {
+    // Gauss-Newton steps from the previous pose, a couple are enough between consecutive frames
+    int maxIterations = 5;
+    // a warm error above jumpRate times the previous error plus jumpPixels means the guess led the solve
+    // astray, the marker jumped or the pose flipped, and the pose is solved again from scratch
+    double jumpRate = 2.0;
+    double jumpPixels = 0.5;
+};
+
+/**
+ * Remembers the pose of every id solved in the last frame, id -1 for a board, and refines it on the new
+ * frame's points with a few Gauss-Newton steps on the projectPoints jacobian, instead of the cold
+ * solvePnP that estimatePoseBoard and estimatePoseCharucoBoard run every frame.
+ */
+class warm_pose_solver {
+public:
+    explicit warm_pose_solver(const warm_start_options &options);
+
+    /**
+     * Start a frame, only poses of the frame before are used as guesses
+     */
+    void nextFrame();
+
+    /**
+     * Refine the previous frame's pose of id on these points and remember the result
+     *
+     * @param error RMS reprojection error of the pose in pixels
+     * @return false when there is no guess or the error jumped, solve cold and remember that pose instead
+     */
+    bool solve(int id, const std::vector< cv::Point3f > &objectPoints, const std::vector< cv::Point2f > &imagePoints,
+               const cv::Mat &camMatrix, const cv::Mat &distCoeffs, cv::Vec3d &rvec, cv::Vec3d &tvec, double &error);
+
+    /**
+     * Pose of id in this frame, the guess for the next one
+     */
+    void remember(int id, const cv::Vec3d &rvec, const cv::Vec3d &tvec, double error);
+
+    size_t warmSolves() const { return warmCount; }
+    size_t coldSolves() const { return coldCount; }
+
+private:
+    struct guess {
+        int id;
+        unsigned frame;
+        cv::Vec3d rvec, tvec;
+        double error;
+    };
+
+    double squaredError(const std::vector< cv::Point2f > &imagePoints) const;
+
+    warm_start_options options;
+    std::vector< guess > guesses;
+    unsigned frame;
+    size_t warmCount, coldCount;
+
+    // scratch buffers kept between solves
+    std::vector< cv::Point2f > projected;
+    cv::Mat jacobian;
+};
+
+
+#endif //ARUCO_TEST_WARM_POSE_H
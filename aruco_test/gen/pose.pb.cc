@@ -1,563 +1,1751 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: pose.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "pose.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace proto {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* CameraPose_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CameraPose_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_pose_2eproto() {
-  protobuf_AddDesc_pose_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "pose.proto");
-  GOOGLE_CHECK(file != NULL);
-  CameraPose_descriptor_ = file->message_type(0);
-  static const int CameraPose_offsets_[7] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraPose, x_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraPose, y_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraPose, z_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraPose, yaw_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraPose, pitch_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraPose, roll_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraPose, navxtime_),
+namespace proto {
+PROTOBUF_CONSTEXPR CameraPose::CameraPose(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.z_)*/0
+  , /*decltype(_impl_.yaw_)*/0
+  , /*decltype(_impl_.pitch_)*/0
+  , /*decltype(_impl_.roll_)*/0
+  , /*decltype(_impl_.navxtime_)*/0} {}
+struct CameraPoseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CameraPoseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CameraPoseDefaultTypeInternal() {}
+  union {
+    CameraPose _instance;
   };
-  CameraPose_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CameraPose_descriptor_,
-      CameraPose::default_instance_,
-      CameraPose_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraPose, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraPose, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CameraPose));
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CameraPoseDefaultTypeInternal _CameraPose_default_instance_;
+PROTOBUF_CONSTEXPR Detection::Detection(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.corners_)*/{}
+  , /*decltype(_impl_.posevariance_)*/{}
+  , /*decltype(_impl_.velocity_)*/{}
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.z_)*/0
+  , /*decltype(_impl_.rx_)*/0
+  , /*decltype(_impl_.ry_)*/0
+  , /*decltype(_impl_.rz_)*/0
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.predicted_)*/false
+  , /*decltype(_impl_.yaw_)*/0
+  , /*decltype(_impl_.pitch_)*/0
+  , /*decltype(_impl_.roll_)*/0
+  , /*decltype(_impl_.reprojectionerror_)*/0
+  , /*decltype(_impl_.alternativereprojectionerror_)*/0
+  , /*decltype(_impl_.qw_)*/0
+  , /*decltype(_impl_.qx_)*/0
+  , /*decltype(_impl_.qy_)*/0
+  , /*decltype(_impl_.qz_)*/0} {}
+struct DetectionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DetectionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DetectionDefaultTypeInternal() {}
+  union {
+    Detection _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DetectionDefaultTypeInternal _Detection_default_instance_;
+PROTOBUF_CONSTEXPR FrameDetections::FrameDetections(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.detections_)*/{}
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.frameindex_)*/0u
+  , /*decltype(_impl_.cameraid_)*/0u
+  , /*decltype(_impl_.capturemonotonicus_)*/uint64_t{0u}
+  , /*decltype(_impl_.capturewallus_)*/uint64_t{0u}} {}
+struct FrameDetectionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FrameDetectionsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FrameDetectionsDefaultTypeInternal() {}
+  union {
+    FrameDetections _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FrameDetectionsDefaultTypeInternal _FrameDetections_default_instance_;
+}  // namespace proto
+static ::_pb::Metadata file_level_metadata_pose_2eproto[3];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_pose_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_pose_2eproto = nullptr;
+
+const uint32_t TableStruct_pose_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::proto::CameraPose, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto::CameraPose, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::CameraPose, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::proto::CameraPose, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::proto::CameraPose, _impl_.z_),
+  PROTOBUF_FIELD_OFFSET(::proto::CameraPose, _impl_.yaw_),
+  PROTOBUF_FIELD_OFFSET(::proto::CameraPose, _impl_.pitch_),
+  PROTOBUF_FIELD_OFFSET(::proto::CameraPose, _impl_.roll_),
+  PROTOBUF_FIELD_OFFSET(::proto::CameraPose, _impl_.navxtime_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.z_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.rx_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.ry_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.rz_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.yaw_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.pitch_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.roll_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.corners_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.reprojectionerror_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.predicted_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.posevariance_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.velocity_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.alternativereprojectionerror_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.qw_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.qx_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.qy_),
+  PROTOBUF_FIELD_OFFSET(::proto::Detection, _impl_.qz_),
+  6,
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  8,
+  9,
+  10,
+  ~0u,
+  11,
+  7,
+  ~0u,
+  ~0u,
+  12,
+  13,
+  14,
+  15,
+  16,
+  PROTOBUF_FIELD_OFFSET(::proto::FrameDetections, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto::FrameDetections, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::FrameDetections, _impl_.frameindex_),
+  PROTOBUF_FIELD_OFFSET(::proto::FrameDetections, _impl_.detections_),
+  PROTOBUF_FIELD_OFFSET(::proto::FrameDetections, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::proto::FrameDetections, _impl_.capturemonotonicus_),
+  PROTOBUF_FIELD_OFFSET(::proto::FrameDetections, _impl_.capturewallus_),
+  PROTOBUF_FIELD_OFFSET(::proto::FrameDetections, _impl_.cameraid_),
+  1,
+  ~0u,
+  0,
+  3,
+  4,
+  2,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 13, -1, sizeof(::proto::CameraPose)},
+  { 20, 46, -1, sizeof(::proto::Detection)},
+  { 66, 78, -1, sizeof(::proto::FrameDetections)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::proto::_CameraPose_default_instance_._instance,
+  &::proto::_Detection_default_instance_._instance,
+  &::proto::_FrameDetections_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_pose_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\npose.proto\022\005proto\"i\n\nCameraPose\022\t\n\001x\030\001"
+  " \001(\001\022\t\n\001y\030\002 \001(\001\022\t\n\001z\030\003 \001(\001\022\013\n\003yaw\030\004 \001(\001\022"
+  "\r\n\005pitch\030\005 \001(\001\022\014\n\004roll\030\006 \001(\001\022\020\n\010navXTime"
+  "\030\007 \001(\005\"\317\002\n\tDetection\022\n\n\002id\030\001 \001(\005\022\t\n\001x\030\002 "
+  "\001(\001\022\t\n\001y\030\003 \001(\001\022\t\n\001z\030\004 \001(\001\022\n\n\002rx\030\005 \001(\001\022\n\n"
+  "\002ry\030\006 \001(\001\022\n\n\002rz\030\007 \001(\001\022\013\n\003yaw\030\010 \001(\001\022\r\n\005pi"
+  "tch\030\t \001(\001\022\014\n\004roll\030\n \001(\001\022\023\n\007corners\030\013 \003(\002"
+  "B\002\020\001\022\031\n\021reprojectionError\030\014 \001(\001\022\021\n\tpredi"
+  "cted\030\r \001(\010\022\030\n\014poseVariance\030\016 \003(\001B\002\020\001\022\024\n\010"
+  "velocity\030\017 \003(\001B\002\020\001\022$\n\034alternativeReproje"
+  "ctionError\030\020 \001(\001\022\n\n\002qw\030\021 \001(\001\022\n\n\002qx\030\022 \001(\001"
+  "\022\n\n\002qy\030\023 \001(\001\022\n\n\002qz\030\024 \001(\001\"\242\001\n\017FrameDetect"
+  "ions\022\022\n\nframeIndex\030\001 \001(\r\022$\n\ndetections\030\002"
+  " \003(\0132\020.proto.Detection\022\020\n\010sequence\030\003 \001(\004"
+  "\022\032\n\022captureMonotonicUs\030\004 \001(\004\022\025\n\rcaptureW"
+  "allUs\030\005 \001(\004\022\020\n\010cameraId\030\006 \001(\r"
+  ;
+static ::_pbi::once_flag descriptor_table_pose_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_pose_2eproto = {
+    false, false, 629, descriptor_table_protodef_pose_2eproto,
+    "pose.proto",
+    &descriptor_table_pose_2eproto_once, nullptr, 0, 3,
+    schemas, file_default_instances, TableStruct_pose_2eproto::offsets,
+    file_level_metadata_pose_2eproto, file_level_enum_descriptors_pose_2eproto,
+    file_level_service_descriptors_pose_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_pose_2eproto_getter() {
+  return &descriptor_table_pose_2eproto;
 }
 
-namespace {
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_pose_2eproto(&descriptor_table_pose_2eproto);
+namespace proto {
+
+// ===================================================================
 
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_pose_2eproto);
+class CameraPose::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CameraPose>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_z(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_yaw(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_pitch(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_roll(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_navxtime(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
+
+CameraPose::CameraPose(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.CameraPose)
+}
+CameraPose::CameraPose(const CameraPose& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CameraPose* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.z_){}
+    , decltype(_impl_.yaw_){}
+    , decltype(_impl_.pitch_){}
+    , decltype(_impl_.roll_){}
+    , decltype(_impl_.navxtime_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.navxtime_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.navxtime_));
+  // @@protoc_insertion_point(copy_constructor:proto.CameraPose)
 }
 
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CameraPose_descriptor_, &CameraPose::default_instance());
+inline void CameraPose::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.z_){0}
+    , decltype(_impl_.yaw_){0}
+    , decltype(_impl_.pitch_){0}
+    , decltype(_impl_.roll_){0}
+    , decltype(_impl_.navxtime_){0}
+  };
 }
 
-}  // namespace
+CameraPose::~CameraPose() {
+  // @@protoc_insertion_point(destructor:proto.CameraPose)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-void protobuf_ShutdownFile_pose_2eproto() {
-  delete CameraPose::default_instance_;
-  delete CameraPose_reflection_;
+inline void CameraPose::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void protobuf_AddDesc_pose_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+void CameraPose::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\npose.proto\022\005proto\"i\n\nCameraPose\022\t\n\001x\030\001"
-    " \001(\001\022\t\n\001y\030\002 \001(\001\022\t\n\001z\030\003 \001(\001\022\013\n\003yaw\030\004 \001(\001\022"
-    "\r\n\005pitch\030\005 \001(\001\022\014\n\004roll\030\006 \001(\001\022\020\n\010navXTime"
-    "\030\007 \001(\005", 126);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "pose.proto", &protobuf_RegisterTypes);
-  CameraPose::default_instance_ = new CameraPose();
-  CameraPose::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_pose_2eproto);
+void CameraPose::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.CameraPose)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.navxtime_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.navxtime_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CameraPose::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional double x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double z = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_z(&has_bits);
+          _impl_.z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double yaw = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_yaw(&has_bits);
+          _impl_.yaw_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double pitch = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_pitch(&has_bits);
+          _impl_.pitch_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double roll = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_roll(&has_bits);
+          _impl_.roll_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 navXTime = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_navxtime(&has_bits);
+          _impl_.navxtime_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_pose_2eproto {
-  StaticDescriptorInitializer_pose_2eproto() {
-    protobuf_AddDesc_pose_2eproto();
+uint8_t* CameraPose::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.CameraPose)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional double x = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_x(), target);
   }
-} static_descriptor_initializer_pose_2eproto_;
 
-// ===================================================================
+  // optional double y = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_y(), target);
+  }
 
-#ifndef _MSC_VER
-const int CameraPose::kXFieldNumber;
-const int CameraPose::kYFieldNumber;
-const int CameraPose::kZFieldNumber;
-const int CameraPose::kYawFieldNumber;
-const int CameraPose::kPitchFieldNumber;
-const int CameraPose::kRollFieldNumber;
-const int CameraPose::kNavXTimeFieldNumber;
-#endif  // !_MSC_VER
+  // optional double z = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_z(), target);
+  }
 
-CameraPose::CameraPose()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:proto.CameraPose)
-}
+  // optional double yaw = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_yaw(), target);
+  }
 
-void CameraPose::InitAsDefaultInstance() {
-}
+  // optional double pitch = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_pitch(), target);
+  }
 
-CameraPose::CameraPose(const CameraPose& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:proto.CameraPose)
-}
+  // optional double roll = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_roll(), target);
+  }
 
-void CameraPose::SharedCtor() {
-  _cached_size_ = 0;
-  x_ = 0;
-  y_ = 0;
-  z_ = 0;
-  yaw_ = 0;
-  pitch_ = 0;
-  roll_ = 0;
-  navxtime_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
+  // optional int32 navXTime = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_navxtime(), target);
+  }
 
-CameraPose::~CameraPose() {
-  // @@protoc_insertion_point(destructor:proto.CameraPose)
-  SharedDtor();
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.CameraPose)
+  return target;
 }
 
-void CameraPose::SharedDtor() {
-  if (this != default_instance_) {
+size_t CameraPose::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.CameraPose)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    // optional double x = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double y = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double z = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double yaw = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double pitch = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double roll = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 navXTime = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_navxtime());
+    }
+
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CameraPose::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CameraPose::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CameraPose::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CameraPose::GetClassData() const { return &_class_data_; }
+
+
+void CameraPose::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CameraPose*>(&to_msg);
+  auto& from = static_cast<const CameraPose&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.CameraPose)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.z_ = from._impl_.z_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.yaw_ = from._impl_.yaw_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.pitch_ = from._impl_.pitch_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.roll_ = from._impl_.roll_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.navxtime_ = from._impl_.navxtime_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-const ::google::protobuf::Descriptor* CameraPose::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CameraPose_descriptor_;
+
+void CameraPose::CopyFrom(const CameraPose& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.CameraPose)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-const CameraPose& CameraPose::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_pose_2eproto();
-  return *default_instance_;
+bool CameraPose::IsInitialized() const {
+  return true;
 }
 
-CameraPose* CameraPose::default_instance_ = NULL;
+void CameraPose::InternalSwap(CameraPose* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CameraPose, _impl_.navxtime_)
+      + sizeof(CameraPose::_impl_.navxtime_)
+      - PROTOBUF_FIELD_OFFSET(CameraPose, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
+}
 
-CameraPose* CameraPose::New() const {
-  return new CameraPose;
+::PROTOBUF_NAMESPACE_ID::Metadata CameraPose::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_pose_2eproto_getter, &descriptor_table_pose_2eproto_once,
+      file_level_metadata_pose_2eproto[0]);
 }
 
-void CameraPose::Clear() {
-#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
-  &reinterpret_cast<CameraPose*>(16)->f) - \
-   reinterpret_cast<char*>(16))
+// ===================================================================
+
+class Detection::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Detection>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_z(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_rx(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_ry(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_rz(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_yaw(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_pitch(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_roll(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_reprojectionerror(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_predicted(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_alternativereprojectionerror(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_qw(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_qx(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_qy(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_qz(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+};
 
-#define ZR_(first, last) do {                              \
-    size_t f = OFFSET_OF_FIELD_(first);                    \
-    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
-    ::memset(&first, 0, n);                                \
-  } while (0)
+Detection::Detection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.Detection)
+}
+Detection::Detection(const Detection& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Detection* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.corners_){from._impl_.corners_}
+    , decltype(_impl_.posevariance_){from._impl_.posevariance_}
+    , decltype(_impl_.velocity_){from._impl_.velocity_}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.z_){}
+    , decltype(_impl_.rx_){}
+    , decltype(_impl_.ry_){}
+    , decltype(_impl_.rz_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.predicted_){}
+    , decltype(_impl_.yaw_){}
+    , decltype(_impl_.pitch_){}
+    , decltype(_impl_.roll_){}
+    , decltype(_impl_.reprojectionerror_){}
+    , decltype(_impl_.alternativereprojectionerror_){}
+    , decltype(_impl_.qw_){}
+    , decltype(_impl_.qx_){}
+    , decltype(_impl_.qy_){}
+    , decltype(_impl_.qz_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.qz_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.qz_));
+  // @@protoc_insertion_point(copy_constructor:proto.Detection)
+}
 
-  if (_has_bits_[0 / 32] & 127) {
-    ZR_(x_, navxtime_);
+inline void Detection::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.corners_){arena}
+    , decltype(_impl_.posevariance_){arena}
+    , decltype(_impl_.velocity_){arena}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.z_){0}
+    , decltype(_impl_.rx_){0}
+    , decltype(_impl_.ry_){0}
+    , decltype(_impl_.rz_){0}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.predicted_){false}
+    , decltype(_impl_.yaw_){0}
+    , decltype(_impl_.pitch_){0}
+    , decltype(_impl_.roll_){0}
+    , decltype(_impl_.reprojectionerror_){0}
+    , decltype(_impl_.alternativereprojectionerror_){0}
+    , decltype(_impl_.qw_){0}
+    , decltype(_impl_.qx_){0}
+    , decltype(_impl_.qy_){0}
+    , decltype(_impl_.qz_){0}
+  };
+}
+
+Detection::~Detection() {
+  // @@protoc_insertion_point(destructor:proto.Detection)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-#undef OFFSET_OF_FIELD_
-#undef ZR_
+inline void Detection::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.corners_.~RepeatedField();
+  _impl_.posevariance_.~RepeatedField();
+  _impl_.velocity_.~RepeatedField();
+}
 
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+void Detection::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-bool CameraPose::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:proto.CameraPose)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional double x = 1;
-      case 1: {
-        if (tag == 9) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &x_)));
-          set_has_x();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(17)) goto parse_y;
-        break;
-      }
+void Detection::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.Detection)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.corners_.Clear();
+  _impl_.posevariance_.Clear();
+  _impl_.velocity_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.predicted_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.predicted_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.yaw_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.qy_) -
+        reinterpret_cast<char*>(&_impl_.yaw_)) + sizeof(_impl_.qy_));
+  }
+  _impl_.qz_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
-      // optional double y = 2;
-      case 2: {
-        if (tag == 17) {
-         parse_y:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &y_)));
-          set_has_y();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(25)) goto parse_z;
-        break;
-      }
+const char* Detection::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double x = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double y = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double z = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_z(&has_bits);
+          _impl_.z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rx = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_rx(&has_bits);
+          _impl_.rx_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double ry = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_ry(&has_bits);
+          _impl_.ry_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rz = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_rz(&has_bits);
+          _impl_.rz_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double yaw = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_yaw(&has_bits);
+          _impl_.yaw_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double pitch = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_pitch(&has_bits);
+          _impl_.pitch_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double roll = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _Internal::set_has_roll(&has_bits);
+          _impl_.roll_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float corners = 11 [packed = true];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_corners(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 93) {
+          _internal_add_corners(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double reprojectionError = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_reprojectionerror(&has_bits);
+          _impl_.reprojectionerror_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool predicted = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_predicted(&has_bits);
+          _impl_.predicted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double poseVariance = 14 [packed = true];
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_posevariance(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 113) {
+          _internal_add_posevariance(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double velocity = 15 [packed = true];
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_velocity(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 121) {
+          _internal_add_velocity(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double alternativeReprojectionError = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 129)) {
+          _Internal::set_has_alternativereprojectionerror(&has_bits);
+          _impl_.alternativereprojectionerror_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double qw = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 137)) {
+          _Internal::set_has_qw(&has_bits);
+          _impl_.qw_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double qx = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 145)) {
+          _Internal::set_has_qx(&has_bits);
+          _impl_.qx_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double qy = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 153)) {
+          _Internal::set_has_qy(&has_bits);
+          _impl_.qy_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double qz = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 161)) {
+          _Internal::set_has_qz(&has_bits);
+          _impl_.qz_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
 
-      // optional double z = 3;
-      case 3: {
-        if (tag == 25) {
-         parse_z:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &z_)));
-          set_has_z();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(33)) goto parse_yaw;
-        break;
-      }
+uint8_t* Detection::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.Detection)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 id = 1;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
+  }
 
-      // optional double yaw = 4;
-      case 4: {
-        if (tag == 33) {
-         parse_yaw:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &yaw_)));
-          set_has_yaw();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(41)) goto parse_pitch;
-        break;
-      }
+  // optional double x = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_x(), target);
+  }
 
-      // optional double pitch = 5;
-      case 5: {
-        if (tag == 41) {
-         parse_pitch:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &pitch_)));
-          set_has_pitch();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(49)) goto parse_roll;
-        break;
-      }
+  // optional double y = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_y(), target);
+  }
 
-      // optional double roll = 6;
-      case 6: {
-        if (tag == 49) {
-         parse_roll:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &roll_)));
-          set_has_roll();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(56)) goto parse_navXTime;
-        break;
-      }
+  // optional double z = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_z(), target);
+  }
 
-      // optional int32 navXTime = 7;
-      case 7: {
-        if (tag == 56) {
-         parse_navXTime:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &navxtime_)));
-          set_has_navxtime();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:proto.CameraPose)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:proto.CameraPose)
-  return false;
-#undef DO_
-}
+  // optional double rx = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_rx(), target);
+  }
 
-void CameraPose::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:proto.CameraPose)
-  // optional double x = 1;
-  if (has_x()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(1, this->x(), output);
+  // optional double ry = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_ry(), target);
   }
 
-  // optional double y = 2;
-  if (has_y()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(2, this->y(), output);
+  // optional double rz = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_rz(), target);
   }
 
-  // optional double z = 3;
-  if (has_z()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(3, this->z(), output);
+  // optional double yaw = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_yaw(), target);
   }
 
-  // optional double yaw = 4;
-  if (has_yaw()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(4, this->yaw(), output);
+  // optional double pitch = 9;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_pitch(), target);
   }
 
-  // optional double pitch = 5;
-  if (has_pitch()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(5, this->pitch(), output);
+  // optional double roll = 10;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_roll(), target);
   }
 
-  // optional double roll = 6;
-  if (has_roll()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(6, this->roll(), output);
+  // repeated float corners = 11 [packed = true];
+  if (this->_internal_corners_size() > 0) {
+    target = stream->WriteFixedPacked(11, _internal_corners(), target);
   }
 
-  // optional int32 navXTime = 7;
-  if (has_navxtime()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(7, this->navxtime(), output);
+  // optional double reprojectionError = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_reprojectionerror(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional bool predicted = 13;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(13, this->_internal_predicted(), target);
   }
-  // @@protoc_insertion_point(serialize_end:proto.CameraPose)
-}
 
-::google::protobuf::uint8* CameraPose::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:proto.CameraPose)
-  // optional double x = 1;
-  if (has_x()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(1, this->x(), target);
+  // repeated double poseVariance = 14 [packed = true];
+  if (this->_internal_posevariance_size() > 0) {
+    target = stream->WriteFixedPacked(14, _internal_posevariance(), target);
   }
 
-  // optional double y = 2;
-  if (has_y()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(2, this->y(), target);
+  // repeated double velocity = 15 [packed = true];
+  if (this->_internal_velocity_size() > 0) {
+    target = stream->WriteFixedPacked(15, _internal_velocity(), target);
   }
 
-  // optional double z = 3;
-  if (has_z()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(3, this->z(), target);
+  // optional double alternativeReprojectionError = 16;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(16, this->_internal_alternativereprojectionerror(), target);
   }
 
-  // optional double yaw = 4;
-  if (has_yaw()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(4, this->yaw(), target);
+  // optional double qw = 17;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(17, this->_internal_qw(), target);
   }
 
-  // optional double pitch = 5;
-  if (has_pitch()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(5, this->pitch(), target);
+  // optional double qx = 18;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(18, this->_internal_qx(), target);
   }
 
-  // optional double roll = 6;
-  if (has_roll()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(6, this->roll(), target);
+  // optional double qy = 19;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(19, this->_internal_qy(), target);
   }
 
-  // optional int32 navXTime = 7;
-  if (has_navxtime()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(7, this->navxtime(), target);
+  // optional double qz = 20;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(20, this->_internal_qz(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:proto.CameraPose)
+  // @@protoc_insertion_point(serialize_to_array_end:proto.Detection)
   return target;
 }
 
-int CameraPose::ByteSize() const {
-  int total_size = 0;
+size_t Detection::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.Detection)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional double x = 1;
-    if (has_x()) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float corners = 11 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_corners_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated double poseVariance = 14 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_posevariance_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated double velocity = 15 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_velocity_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional double x = 2;
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 + 8;
     }
 
-    // optional double y = 2;
-    if (has_y()) {
+    // optional double y = 3;
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 + 8;
     }
 
-    // optional double z = 3;
-    if (has_z()) {
+    // optional double z = 4;
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 + 8;
     }
 
-    // optional double yaw = 4;
-    if (has_yaw()) {
+    // optional double rx = 5;
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 + 8;
     }
 
-    // optional double pitch = 5;
-    if (has_pitch()) {
+    // optional double ry = 6;
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 + 8;
     }
 
-    // optional double roll = 6;
-    if (has_roll()) {
+    // optional double rz = 7;
+    if (cached_has_bits & 0x00000020u) {
       total_size += 1 + 8;
     }
 
-    // optional int32 navXTime = 7;
-    if (has_navxtime()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->navxtime());
+    // optional int32 id = 1;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+    }
+
+    // optional bool predicted = 13;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional double yaw = 8;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double pitch = 9;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double roll = 10;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double reprojectionError = 12;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double alternativeReprojectionError = 16;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double qw = 17;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double qx = 18;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double qy = 19;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 2 + 8;
+    }
 
-void CameraPose::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CameraPose* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CameraPose*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  // optional double qz = 20;
+  if (cached_has_bits & 0x00010000u) {
+    total_size += 2 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CameraPose::MergeFrom(const CameraPose& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_x()) {
-      set_x(from.x());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Detection::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Detection::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Detection::GetClassData() const { return &_class_data_; }
+
+
+void Detection::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Detection*>(&to_msg);
+  auto& from = static_cast<const Detection&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.Detection)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.corners_.MergeFrom(from._impl_.corners_);
+  _this->_impl_.posevariance_.MergeFrom(from._impl_.posevariance_);
+  _this->_impl_.velocity_.MergeFrom(from._impl_.velocity_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.z_ = from._impl_.z_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.rx_ = from._impl_.rx_;
     }
-    if (from.has_y()) {
-      set_y(from.y());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.ry_ = from._impl_.ry_;
     }
-    if (from.has_z()) {
-      set_z(from.z());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.rz_ = from._impl_.rz_;
     }
-    if (from.has_yaw()) {
-      set_yaw(from.yaw());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.id_ = from._impl_.id_;
     }
-    if (from.has_pitch()) {
-      set_pitch(from.pitch());
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.predicted_ = from._impl_.predicted_;
     }
-    if (from.has_roll()) {
-      set_roll(from.roll());
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.yaw_ = from._impl_.yaw_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.pitch_ = from._impl_.pitch_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.roll_ = from._impl_.roll_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.reprojectionerror_ = from._impl_.reprojectionerror_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.alternativereprojectionerror_ = from._impl_.alternativereprojectionerror_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.qw_ = from._impl_.qw_;
     }
-    if (from.has_navxtime()) {
-      set_navxtime(from.navxtime());
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.qx_ = from._impl_.qx_;
     }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.qy_ = from._impl_.qy_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00010000u) {
+    _this->_internal_set_qz(from._internal_qz());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CameraPose::CopyFrom(const ::google::protobuf::Message& from) {
+void Detection::CopyFrom(const Detection& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.Detection)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CameraPose::CopyFrom(const CameraPose& from) {
+bool Detection::IsInitialized() const {
+  return true;
+}
+
+void Detection::InternalSwap(Detection* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.corners_.InternalSwap(&other->_impl_.corners_);
+  _impl_.posevariance_.InternalSwap(&other->_impl_.posevariance_);
+  _impl_.velocity_.InternalSwap(&other->_impl_.velocity_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Detection, _impl_.qz_)
+      + sizeof(Detection::_impl_.qz_)
+      - PROTOBUF_FIELD_OFFSET(Detection, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Detection::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_pose_2eproto_getter, &descriptor_table_pose_2eproto_once,
+      file_level_metadata_pose_2eproto[1]);
+}
+
+// ===================================================================
+
+class FrameDetections::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FrameDetections>()._impl_._has_bits_);
+  static void set_has_frameindex(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_sequence(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_capturemonotonicus(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_capturewallus(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_cameraid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+FrameDetections::FrameDetections(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.FrameDetections)
+}
+FrameDetections::FrameDetections(const FrameDetections& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FrameDetections* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.detections_){from._impl_.detections_}
+    , decltype(_impl_.sequence_){}
+    , decltype(_impl_.frameindex_){}
+    , decltype(_impl_.cameraid_){}
+    , decltype(_impl_.capturemonotonicus_){}
+    , decltype(_impl_.capturewallus_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.sequence_, &from._impl_.sequence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.capturewallus_) -
+    reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.capturewallus_));
+  // @@protoc_insertion_point(copy_constructor:proto.FrameDetections)
+}
+
+inline void FrameDetections::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.detections_){arena}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , decltype(_impl_.frameindex_){0u}
+    , decltype(_impl_.cameraid_){0u}
+    , decltype(_impl_.capturemonotonicus_){uint64_t{0u}}
+    , decltype(_impl_.capturewallus_){uint64_t{0u}}
+  };
+}
+
+FrameDetections::~FrameDetections() {
+  // @@protoc_insertion_point(destructor:proto.FrameDetections)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FrameDetections::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.detections_.~RepeatedPtrField();
+}
+
+void FrameDetections::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FrameDetections::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.FrameDetections)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.detections_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.sequence_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.capturewallus_) -
+        reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.capturewallus_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FrameDetections::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 frameIndex = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_frameindex(&has_bits);
+          _impl_.frameindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .proto.Detection detections = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_detections(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 sequence = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_sequence(&has_bits);
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 captureMonotonicUs = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_capturemonotonicus(&has_bits);
+          _impl_.capturemonotonicus_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 captureWallUs = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_capturewallus(&has_bits);
+          _impl_.capturewallus_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 cameraId = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_cameraid(&has_bits);
+          _impl_.cameraid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FrameDetections::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.FrameDetections)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 frameIndex = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_frameindex(), target);
+  }
+
+  // repeated .proto.Detection detections = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_detections_size()); i < n; i++) {
+    const auto& repfield = this->_internal_detections(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional uint64 sequence = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_sequence(), target);
+  }
+
+  // optional uint64 captureMonotonicUs = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_capturemonotonicus(), target);
+  }
+
+  // optional uint64 captureWallUs = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_capturewallus(), target);
+  }
+
+  // optional uint32 cameraId = 6;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_cameraid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.FrameDetections)
+  return target;
+}
+
+size_t FrameDetections::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.FrameDetections)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .proto.Detection detections = 2;
+  total_size += 1UL * this->_internal_detections_size();
+  for (const auto& msg : this->_impl_.detections_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional uint64 sequence = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+    }
+
+    // optional uint32 frameIndex = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_frameindex());
+    }
+
+    // optional uint32 cameraId = 6;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cameraid());
+    }
+
+    // optional uint64 captureMonotonicUs = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_capturemonotonicus());
+    }
+
+    // optional uint64 captureWallUs = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_capturewallus());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FrameDetections::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FrameDetections::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FrameDetections::GetClassData() const { return &_class_data_; }
+
+
+void FrameDetections::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FrameDetections*>(&to_msg);
+  auto& from = static_cast<const FrameDetections&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.FrameDetections)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.detections_.MergeFrom(from._impl_.detections_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.sequence_ = from._impl_.sequence_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.frameindex_ = from._impl_.frameindex_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.cameraid_ = from._impl_.cameraid_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.capturemonotonicus_ = from._impl_.capturemonotonicus_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.capturewallus_ = from._impl_.capturewallus_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FrameDetections::CopyFrom(const FrameDetections& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.FrameDetections)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CameraPose::IsInitialized() const {
-
+bool FrameDetections::IsInitialized() const {
   return true;
 }
 
-void CameraPose::Swap(CameraPose* other) {
-  if (other != this) {
-    std::swap(x_, other->x_);
-    std::swap(y_, other->y_);
-    std::swap(z_, other->z_);
-    std::swap(yaw_, other->yaw_);
-    std::swap(pitch_, other->pitch_);
-    std::swap(roll_, other->roll_);
-    std::swap(navxtime_, other->navxtime_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void FrameDetections::InternalSwap(FrameDetections* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.detections_.InternalSwap(&other->_impl_.detections_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FrameDetections, _impl_.capturewallus_)
+      + sizeof(FrameDetections::_impl_.capturewallus_)
+      - PROTOBUF_FIELD_OFFSET(FrameDetections, _impl_.sequence_)>(
+          reinterpret_cast<char*>(&_impl_.sequence_),
+          reinterpret_cast<char*>(&other->_impl_.sequence_));
 }
 
-::google::protobuf::Metadata CameraPose::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CameraPose_descriptor_;
-  metadata.reflection = CameraPose_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata FrameDetections::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_pose_2eproto_getter, &descriptor_table_pose_2eproto_once,
+      file_level_metadata_pose_2eproto[2]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace proto
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::proto::CameraPose*
+Arena::CreateMaybeMessage< ::proto::CameraPose >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::CameraPose >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::Detection*
+Arena::CreateMaybeMessage< ::proto::Detection >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::Detection >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::FrameDetections*
+Arena::CreateMaybeMessage< ::proto::FrameDetections >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::FrameDetections >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,368 +1,2054 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: pose.proto
 
-#ifndef PROTOBUF_pose_2eproto__INCLUDED
-#define PROTOBUF_pose_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_pose_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_pose_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2006000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_pose_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
+// Internal implementation detail -- do not use these members.
+struct TableStruct_pose_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_pose_2eproto;
 namespace proto {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_pose_2eproto();
-void protobuf_AssignDesc_pose_2eproto();
-void protobuf_ShutdownFile_pose_2eproto();
-
 class CameraPose;
+struct CameraPoseDefaultTypeInternal;
+extern CameraPoseDefaultTypeInternal _CameraPose_default_instance_;
+class Detection;
+struct DetectionDefaultTypeInternal;
+extern DetectionDefaultTypeInternal _Detection_default_instance_;
+class FrameDetections;
+struct FrameDetectionsDefaultTypeInternal;
+extern FrameDetectionsDefaultTypeInternal _FrameDetections_default_instance_;
+}  // namespace proto
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto::CameraPose* Arena::CreateMaybeMessage<::proto::CameraPose>(Arena*);
+template<> ::proto::Detection* Arena::CreateMaybeMessage<::proto::Detection>(Arena*);
+template<> ::proto::FrameDetections* Arena::CreateMaybeMessage<::proto::FrameDetections>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto {
 
 // ===================================================================
 
-class CameraPose : public ::google::protobuf::Message {
+class CameraPose final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.CameraPose) */ {
+ public:
+  inline CameraPose() : CameraPose(nullptr) {}
+  ~CameraPose() override;
+  explicit PROTOBUF_CONSTEXPR CameraPose(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CameraPose(const CameraPose& from);
+  CameraPose(CameraPose&& from) noexcept
+    : CameraPose() {
+    *this = ::std::move(from);
+  }
+
+  inline CameraPose& operator=(const CameraPose& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CameraPose& operator=(CameraPose&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CameraPose& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CameraPose* internal_default_instance() {
+    return reinterpret_cast<const CameraPose*>(
+               &_CameraPose_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(CameraPose& a, CameraPose& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CameraPose* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CameraPose* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CameraPose* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CameraPose>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CameraPose& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CameraPose& from) {
+    CameraPose::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CameraPose* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.CameraPose";
+  }
+  protected:
+  explicit CameraPose(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kZFieldNumber = 3,
+    kYawFieldNumber = 4,
+    kPitchFieldNumber = 5,
+    kRollFieldNumber = 6,
+    kNavXTimeFieldNumber = 7,
+  };
+  // optional double x = 1;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  double x() const;
+  void set_x(double value);
+  private:
+  double _internal_x() const;
+  void _internal_set_x(double value);
+  public:
+
+  // optional double y = 2;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  double y() const;
+  void set_y(double value);
+  private:
+  double _internal_y() const;
+  void _internal_set_y(double value);
+  public:
+
+  // optional double z = 3;
+  bool has_z() const;
+  private:
+  bool _internal_has_z() const;
+  public:
+  void clear_z();
+  double z() const;
+  void set_z(double value);
+  private:
+  double _internal_z() const;
+  void _internal_set_z(double value);
+  public:
+
+  // optional double yaw = 4;
+  bool has_yaw() const;
+  private:
+  bool _internal_has_yaw() const;
+  public:
+  void clear_yaw();
+  double yaw() const;
+  void set_yaw(double value);
+  private:
+  double _internal_yaw() const;
+  void _internal_set_yaw(double value);
+  public:
+
+  // optional double pitch = 5;
+  bool has_pitch() const;
+  private:
+  bool _internal_has_pitch() const;
+  public:
+  void clear_pitch();
+  double pitch() const;
+  void set_pitch(double value);
+  private:
+  double _internal_pitch() const;
+  void _internal_set_pitch(double value);
+  public:
+
+  // optional double roll = 6;
+  bool has_roll() const;
+  private:
+  bool _internal_has_roll() const;
+  public:
+  void clear_roll();
+  double roll() const;
+  void set_roll(double value);
+  private:
+  double _internal_roll() const;
+  void _internal_set_roll(double value);
+  public:
+
+  // optional int32 navXTime = 7;
+  bool has_navxtime() const;
+  private:
+  bool _internal_has_navxtime() const;
+  public:
+  void clear_navxtime();
+  int32_t navxtime() const;
+  void set_navxtime(int32_t value);
+  private:
+  int32_t _internal_navxtime() const;
+  void _internal_set_navxtime(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.CameraPose)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double x_;
+    double y_;
+    double z_;
+    double yaw_;
+    double pitch_;
+    double roll_;
+    int32_t navxtime_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_pose_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Detection final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.Detection) */ {
  public:
-  CameraPose();
-  virtual ~CameraPose();
+  inline Detection() : Detection(nullptr) {}
+  ~Detection() override;
+  explicit PROTOBUF_CONSTEXPR Detection(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Detection(const Detection& from);
+  Detection(Detection&& from) noexcept
+    : Detection() {
+    *this = ::std::move(from);
+  }
+
+  inline Detection& operator=(const Detection& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Detection& operator=(Detection&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Detection& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Detection* internal_default_instance() {
+    return reinterpret_cast<const Detection*>(
+               &_Detection_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Detection& a, Detection& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Detection* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Detection* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Detection* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Detection>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Detection& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Detection& from) {
+    Detection::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Detection* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.Detection";
+  }
+  protected:
+  explicit Detection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCornersFieldNumber = 11,
+    kPoseVarianceFieldNumber = 14,
+    kVelocityFieldNumber = 15,
+    kXFieldNumber = 2,
+    kYFieldNumber = 3,
+    kZFieldNumber = 4,
+    kRxFieldNumber = 5,
+    kRyFieldNumber = 6,
+    kRzFieldNumber = 7,
+    kIdFieldNumber = 1,
+    kPredictedFieldNumber = 13,
+    kYawFieldNumber = 8,
+    kPitchFieldNumber = 9,
+    kRollFieldNumber = 10,
+    kReprojectionErrorFieldNumber = 12,
+    kAlternativeReprojectionErrorFieldNumber = 16,
+    kQwFieldNumber = 17,
+    kQxFieldNumber = 18,
+    kQyFieldNumber = 19,
+    kQzFieldNumber = 20,
+  };
+  // repeated float corners = 11 [packed = true];
+  int corners_size() const;
+  private:
+  int _internal_corners_size() const;
+  public:
+  void clear_corners();
+  private:
+  float _internal_corners(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_corners() const;
+  void _internal_add_corners(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_corners();
+  public:
+  float corners(int index) const;
+  void set_corners(int index, float value);
+  void add_corners(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      corners() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_corners();
+
+  // repeated double poseVariance = 14 [packed = true];
+  int posevariance_size() const;
+  private:
+  int _internal_posevariance_size() const;
+  public:
+  void clear_posevariance();
+  private:
+  double _internal_posevariance(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_posevariance() const;
+  void _internal_add_posevariance(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_posevariance();
+  public:
+  double posevariance(int index) const;
+  void set_posevariance(int index, double value);
+  void add_posevariance(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      posevariance() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_posevariance();
+
+  // repeated double velocity = 15 [packed = true];
+  int velocity_size() const;
+  private:
+  int _internal_velocity_size() const;
+  public:
+  void clear_velocity();
+  private:
+  double _internal_velocity(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_velocity() const;
+  void _internal_add_velocity(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_velocity();
+  public:
+  double velocity(int index) const;
+  void set_velocity(int index, double value);
+  void add_velocity(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      velocity() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_velocity();
+
+  // optional double x = 2;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  double x() const;
+  void set_x(double value);
+  private:
+  double _internal_x() const;
+  void _internal_set_x(double value);
+  public:
+
+  // optional double y = 3;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  double y() const;
+  void set_y(double value);
+  private:
+  double _internal_y() const;
+  void _internal_set_y(double value);
+  public:
+
+  // optional double z = 4;
+  bool has_z() const;
+  private:
+  bool _internal_has_z() const;
+  public:
+  void clear_z();
+  double z() const;
+  void set_z(double value);
+  private:
+  double _internal_z() const;
+  void _internal_set_z(double value);
+  public:
+
+  // optional double rx = 5;
+  bool has_rx() const;
+  private:
+  bool _internal_has_rx() const;
+  public:
+  void clear_rx();
+  double rx() const;
+  void set_rx(double value);
+  private:
+  double _internal_rx() const;
+  void _internal_set_rx(double value);
+  public:
+
+  // optional double ry = 6;
+  bool has_ry() const;
+  private:
+  bool _internal_has_ry() const;
+  public:
+  void clear_ry();
+  double ry() const;
+  void set_ry(double value);
+  private:
+  double _internal_ry() const;
+  void _internal_set_ry(double value);
+  public:
+
+  // optional double rz = 7;
+  bool has_rz() const;
+  private:
+  bool _internal_has_rz() const;
+  public:
+  void clear_rz();
+  double rz() const;
+  void set_rz(double value);
+  private:
+  double _internal_rz() const;
+  void _internal_set_rz(double value);
+  public:
+
+  // optional int32 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // optional bool predicted = 13;
+  bool has_predicted() const;
+  private:
+  bool _internal_has_predicted() const;
+  public:
+  void clear_predicted();
+  bool predicted() const;
+  void set_predicted(bool value);
+  private:
+  bool _internal_predicted() const;
+  void _internal_set_predicted(bool value);
+  public:
+
+  // optional double yaw = 8;
+  bool has_yaw() const;
+  private:
+  bool _internal_has_yaw() const;
+  public:
+  void clear_yaw();
+  double yaw() const;
+  void set_yaw(double value);
+  private:
+  double _internal_yaw() const;
+  void _internal_set_yaw(double value);
+  public:
+
+  // optional double pitch = 9;
+  bool has_pitch() const;
+  private:
+  bool _internal_has_pitch() const;
+  public:
+  void clear_pitch();
+  double pitch() const;
+  void set_pitch(double value);
+  private:
+  double _internal_pitch() const;
+  void _internal_set_pitch(double value);
+  public:
+
+  // optional double roll = 10;
+  bool has_roll() const;
+  private:
+  bool _internal_has_roll() const;
+  public:
+  void clear_roll();
+  double roll() const;
+  void set_roll(double value);
+  private:
+  double _internal_roll() const;
+  void _internal_set_roll(double value);
+  public:
+
+  // optional double reprojectionError = 12;
+  bool has_reprojectionerror() const;
+  private:
+  bool _internal_has_reprojectionerror() const;
+  public:
+  void clear_reprojectionerror();
+  double reprojectionerror() const;
+  void set_reprojectionerror(double value);
+  private:
+  double _internal_reprojectionerror() const;
+  void _internal_set_reprojectionerror(double value);
+  public:
+
+  // optional double alternativeReprojectionError = 16;
+  bool has_alternativereprojectionerror() const;
+  private:
+  bool _internal_has_alternativereprojectionerror() const;
+  public:
+  void clear_alternativereprojectionerror();
+  double alternativereprojectionerror() const;
+  void set_alternativereprojectionerror(double value);
+  private:
+  double _internal_alternativereprojectionerror() const;
+  void _internal_set_alternativereprojectionerror(double value);
+  public:
+
+  // optional double qw = 17;
+  bool has_qw() const;
+  private:
+  bool _internal_has_qw() const;
+  public:
+  void clear_qw();
+  double qw() const;
+  void set_qw(double value);
+  private:
+  double _internal_qw() const;
+  void _internal_set_qw(double value);
+  public:
+
+  // optional double qx = 18;
+  bool has_qx() const;
+  private:
+  bool _internal_has_qx() const;
+  public:
+  void clear_qx();
+  double qx() const;
+  void set_qx(double value);
+  private:
+  double _internal_qx() const;
+  void _internal_set_qx(double value);
+  public:
+
+  // optional double qy = 19;
+  bool has_qy() const;
+  private:
+  bool _internal_has_qy() const;
+  public:
+  void clear_qy();
+  double qy() const;
+  void set_qy(double value);
+  private:
+  double _internal_qy() const;
+  void _internal_set_qy(double value);
+  public:
+
+  // optional double qz = 20;
+  bool has_qz() const;
+  private:
+  bool _internal_has_qz() const;
+  public:
+  void clear_qz();
+  double qz() const;
+  void set_qz(double value);
+  private:
+  double _internal_qz() const;
+  void _internal_set_qz(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.Detection)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > corners_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > posevariance_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > velocity_;
+    double x_;
+    double y_;
+    double z_;
+    double rx_;
+    double ry_;
+    double rz_;
+    int32_t id_;
+    bool predicted_;
+    double yaw_;
+    double pitch_;
+    double roll_;
+    double reprojectionerror_;
+    double alternativereprojectionerror_;
+    double qw_;
+    double qx_;
+    double qy_;
+    double qz_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_pose_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FrameDetections final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.FrameDetections) */ {
+ public:
+  inline FrameDetections() : FrameDetections(nullptr) {}
+  ~FrameDetections() override;
+  explicit PROTOBUF_CONSTEXPR FrameDetections(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FrameDetections(const FrameDetections& from);
+  FrameDetections(FrameDetections&& from) noexcept
+    : FrameDetections() {
+    *this = ::std::move(from);
+  }
+
+  inline FrameDetections& operator=(const FrameDetections& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FrameDetections& operator=(FrameDetections&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FrameDetections& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FrameDetections* internal_default_instance() {
+    return reinterpret_cast<const FrameDetections*>(
+               &_FrameDetections_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(FrameDetections& a, FrameDetections& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FrameDetections* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FrameDetections* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FrameDetections* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FrameDetections>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FrameDetections& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FrameDetections& from) {
+    FrameDetections::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FrameDetections* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.FrameDetections";
+  }
+  protected:
+  explicit FrameDetections(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDetectionsFieldNumber = 2,
+    kSequenceFieldNumber = 3,
+    kFrameIndexFieldNumber = 1,
+    kCameraIdFieldNumber = 6,
+    kCaptureMonotonicUsFieldNumber = 4,
+    kCaptureWallUsFieldNumber = 5,
+  };
+  // repeated .proto.Detection detections = 2;
+  int detections_size() const;
+  private:
+  int _internal_detections_size() const;
+  public:
+  void clear_detections();
+  ::proto::Detection* mutable_detections(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Detection >*
+      mutable_detections();
+  private:
+  const ::proto::Detection& _internal_detections(int index) const;
+  ::proto::Detection* _internal_add_detections();
+  public:
+  const ::proto::Detection& detections(int index) const;
+  ::proto::Detection* add_detections();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Detection >&
+      detections() const;
+
+  // optional uint64 sequence = 3;
+  bool has_sequence() const;
+  private:
+  bool _internal_has_sequence() const;
+  public:
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // optional uint32 frameIndex = 1;
+  bool has_frameindex() const;
+  private:
+  bool _internal_has_frameindex() const;
+  public:
+  void clear_frameindex();
+  uint32_t frameindex() const;
+  void set_frameindex(uint32_t value);
+  private:
+  uint32_t _internal_frameindex() const;
+  void _internal_set_frameindex(uint32_t value);
+  public:
+
+  // optional uint32 cameraId = 6;
+  bool has_cameraid() const;
+  private:
+  bool _internal_has_cameraid() const;
+  public:
+  void clear_cameraid();
+  uint32_t cameraid() const;
+  void set_cameraid(uint32_t value);
+  private:
+  uint32_t _internal_cameraid() const;
+  void _internal_set_cameraid(uint32_t value);
+  public:
+
+  // optional uint64 captureMonotonicUs = 4;
+  bool has_capturemonotonicus() const;
+  private:
+  bool _internal_has_capturemonotonicus() const;
+  public:
+  void clear_capturemonotonicus();
+  uint64_t capturemonotonicus() const;
+  void set_capturemonotonicus(uint64_t value);
+  private:
+  uint64_t _internal_capturemonotonicus() const;
+  void _internal_set_capturemonotonicus(uint64_t value);
+  public:
+
+  // optional uint64 captureWallUs = 5;
+  bool has_capturewallus() const;
+  private:
+  bool _internal_has_capturewallus() const;
+  public:
+  void clear_capturewallus();
+  uint64_t capturewallus() const;
+  void set_capturewallus(uint64_t value);
+  private:
+  uint64_t _internal_capturewallus() const;
+  void _internal_set_capturewallus(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.FrameDetections)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Detection > detections_;
+    uint64_t sequence_;
+    uint32_t frameindex_;
+    uint32_t cameraid_;
+    uint64_t capturemonotonicus_;
+    uint64_t capturewallus_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_pose_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CameraPose
+
+// optional double x = 1;
+inline bool CameraPose::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CameraPose::has_x() const {
+  return _internal_has_x();
+}
+inline void CameraPose::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double CameraPose::_internal_x() const {
+  return _impl_.x_;
+}
+inline double CameraPose::x() const {
+  // @@protoc_insertion_point(field_get:proto.CameraPose.x)
+  return _internal_x();
+}
+inline void CameraPose::_internal_set_x(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+inline void CameraPose::set_x(double value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:proto.CameraPose.x)
+}
+
+// optional double y = 2;
+inline bool CameraPose::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CameraPose::has_y() const {
+  return _internal_has_y();
+}
+inline void CameraPose::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double CameraPose::_internal_y() const {
+  return _impl_.y_;
+}
+inline double CameraPose::y() const {
+  // @@protoc_insertion_point(field_get:proto.CameraPose.y)
+  return _internal_y();
+}
+inline void CameraPose::_internal_set_y(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
+}
+inline void CameraPose::set_y(double value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:proto.CameraPose.y)
+}
+
+// optional double z = 3;
+inline bool CameraPose::_internal_has_z() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CameraPose::has_z() const {
+  return _internal_has_z();
+}
+inline void CameraPose::clear_z() {
+  _impl_.z_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double CameraPose::_internal_z() const {
+  return _impl_.z_;
+}
+inline double CameraPose::z() const {
+  // @@protoc_insertion_point(field_get:proto.CameraPose.z)
+  return _internal_z();
+}
+inline void CameraPose::_internal_set_z(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.z_ = value;
+}
+inline void CameraPose::set_z(double value) {
+  _internal_set_z(value);
+  // @@protoc_insertion_point(field_set:proto.CameraPose.z)
+}
+
+// optional double yaw = 4;
+inline bool CameraPose::_internal_has_yaw() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CameraPose::has_yaw() const {
+  return _internal_has_yaw();
+}
+inline void CameraPose::clear_yaw() {
+  _impl_.yaw_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double CameraPose::_internal_yaw() const {
+  return _impl_.yaw_;
+}
+inline double CameraPose::yaw() const {
+  // @@protoc_insertion_point(field_get:proto.CameraPose.yaw)
+  return _internal_yaw();
+}
+inline void CameraPose::_internal_set_yaw(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.yaw_ = value;
+}
+inline void CameraPose::set_yaw(double value) {
+  _internal_set_yaw(value);
+  // @@protoc_insertion_point(field_set:proto.CameraPose.yaw)
+}
+
+// optional double pitch = 5;
+inline bool CameraPose::_internal_has_pitch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CameraPose::has_pitch() const {
+  return _internal_has_pitch();
+}
+inline void CameraPose::clear_pitch() {
+  _impl_.pitch_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double CameraPose::_internal_pitch() const {
+  return _impl_.pitch_;
+}
+inline double CameraPose::pitch() const {
+  // @@protoc_insertion_point(field_get:proto.CameraPose.pitch)
+  return _internal_pitch();
+}
+inline void CameraPose::_internal_set_pitch(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.pitch_ = value;
+}
+inline void CameraPose::set_pitch(double value) {
+  _internal_set_pitch(value);
+  // @@protoc_insertion_point(field_set:proto.CameraPose.pitch)
+}
+
+// optional double roll = 6;
+inline bool CameraPose::_internal_has_roll() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CameraPose::has_roll() const {
+  return _internal_has_roll();
+}
+inline void CameraPose::clear_roll() {
+  _impl_.roll_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double CameraPose::_internal_roll() const {
+  return _impl_.roll_;
+}
+inline double CameraPose::roll() const {
+  // @@protoc_insertion_point(field_get:proto.CameraPose.roll)
+  return _internal_roll();
+}
+inline void CameraPose::_internal_set_roll(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.roll_ = value;
+}
+inline void CameraPose::set_roll(double value) {
+  _internal_set_roll(value);
+  // @@protoc_insertion_point(field_set:proto.CameraPose.roll)
+}
 
-  CameraPose(const CameraPose& from);
+// optional int32 navXTime = 7;
+inline bool CameraPose::_internal_has_navxtime() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool CameraPose::has_navxtime() const {
+  return _internal_has_navxtime();
+}
+inline void CameraPose::clear_navxtime() {
+  _impl_.navxtime_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t CameraPose::_internal_navxtime() const {
+  return _impl_.navxtime_;
+}
+inline int32_t CameraPose::navxtime() const {
+  // @@protoc_insertion_point(field_get:proto.CameraPose.navXTime)
+  return _internal_navxtime();
+}
+inline void CameraPose::_internal_set_navxtime(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.navxtime_ = value;
+}
+inline void CameraPose::set_navxtime(int32_t value) {
+  _internal_set_navxtime(value);
+  // @@protoc_insertion_point(field_set:proto.CameraPose.navXTime)
+}
 
-  inline CameraPose& operator=(const CameraPose& from) {
-    CopyFrom(from);
-    return *this;
-  }
+// -------------------------------------------------------------------
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
+// Detection
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
+// optional int32 id = 1;
+inline bool Detection::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Detection::has_id() const {
+  return _internal_has_id();
+}
+inline void Detection::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t Detection::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Detection::id() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.id)
+  return _internal_id();
+}
+inline void Detection::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.id_ = value;
+}
+inline void Detection::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.id)
+}
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CameraPose& default_instance();
+// optional double x = 2;
+inline bool Detection::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Detection::has_x() const {
+  return _internal_has_x();
+}
+inline void Detection::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double Detection::_internal_x() const {
+  return _impl_.x_;
+}
+inline double Detection::x() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.x)
+  return _internal_x();
+}
+inline void Detection::_internal_set_x(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+inline void Detection::set_x(double value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.x)
+}
 
-  void Swap(CameraPose* other);
+// optional double y = 3;
+inline bool Detection::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Detection::has_y() const {
+  return _internal_has_y();
+}
+inline void Detection::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double Detection::_internal_y() const {
+  return _impl_.y_;
+}
+inline double Detection::y() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.y)
+  return _internal_y();
+}
+inline void Detection::_internal_set_y(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
+}
+inline void Detection::set_y(double value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.y)
+}
 
-  // implements Message ----------------------------------------------
+// optional double z = 4;
+inline bool Detection::_internal_has_z() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Detection::has_z() const {
+  return _internal_has_z();
+}
+inline void Detection::clear_z() {
+  _impl_.z_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double Detection::_internal_z() const {
+  return _impl_.z_;
+}
+inline double Detection::z() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.z)
+  return _internal_z();
+}
+inline void Detection::_internal_set_z(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.z_ = value;
+}
+inline void Detection::set_z(double value) {
+  _internal_set_z(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.z)
+}
 
-  CameraPose* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CameraPose& from);
-  void MergeFrom(const CameraPose& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
+// optional double rx = 5;
+inline bool Detection::_internal_has_rx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Detection::has_rx() const {
+  return _internal_has_rx();
+}
+inline void Detection::clear_rx() {
+  _impl_.rx_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double Detection::_internal_rx() const {
+  return _impl_.rx_;
+}
+inline double Detection::rx() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.rx)
+  return _internal_rx();
+}
+inline void Detection::_internal_set_rx(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.rx_ = value;
+}
+inline void Detection::set_rx(double value) {
+  _internal_set_rx(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.rx)
+}
 
-  // nested types ----------------------------------------------------
+// optional double ry = 6;
+inline bool Detection::_internal_has_ry() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Detection::has_ry() const {
+  return _internal_has_ry();
+}
+inline void Detection::clear_ry() {
+  _impl_.ry_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double Detection::_internal_ry() const {
+  return _impl_.ry_;
+}
+inline double Detection::ry() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.ry)
+  return _internal_ry();
+}
+inline void Detection::_internal_set_ry(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.ry_ = value;
+}
+inline void Detection::set_ry(double value) {
+  _internal_set_ry(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.ry)
+}
 
-  // accessors -------------------------------------------------------
+// optional double rz = 7;
+inline bool Detection::_internal_has_rz() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Detection::has_rz() const {
+  return _internal_has_rz();
+}
+inline void Detection::clear_rz() {
+  _impl_.rz_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double Detection::_internal_rz() const {
+  return _impl_.rz_;
+}
+inline double Detection::rz() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.rz)
+  return _internal_rz();
+}
+inline void Detection::_internal_set_rz(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.rz_ = value;
+}
+inline void Detection::set_rz(double value) {
+  _internal_set_rz(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.rz)
+}
 
-  // optional double x = 1;
-  inline bool has_x() const;
-  inline void clear_x();
-  static const int kXFieldNumber = 1;
-  inline double x() const;
-  inline void set_x(double value);
+// optional double yaw = 8;
+inline bool Detection::_internal_has_yaw() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Detection::has_yaw() const {
+  return _internal_has_yaw();
+}
+inline void Detection::clear_yaw() {
+  _impl_.yaw_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double Detection::_internal_yaw() const {
+  return _impl_.yaw_;
+}
+inline double Detection::yaw() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.yaw)
+  return _internal_yaw();
+}
+inline void Detection::_internal_set_yaw(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.yaw_ = value;
+}
+inline void Detection::set_yaw(double value) {
+  _internal_set_yaw(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.yaw)
+}
 
-  // optional double y = 2;
-  inline bool has_y() const;
-  inline void clear_y();
-  static const int kYFieldNumber = 2;
-  inline double y() const;
-  inline void set_y(double value);
+// optional double pitch = 9;
+inline bool Detection::_internal_has_pitch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Detection::has_pitch() const {
+  return _internal_has_pitch();
+}
+inline void Detection::clear_pitch() {
+  _impl_.pitch_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline double Detection::_internal_pitch() const {
+  return _impl_.pitch_;
+}
+inline double Detection::pitch() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.pitch)
+  return _internal_pitch();
+}
+inline void Detection::_internal_set_pitch(double value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.pitch_ = value;
+}
+inline void Detection::set_pitch(double value) {
+  _internal_set_pitch(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.pitch)
+}
 
-  // optional double z = 3;
-  inline bool has_z() const;
-  inline void clear_z();
-  static const int kZFieldNumber = 3;
-  inline double z() const;
-  inline void set_z(double value);
+// optional double roll = 10;
+inline bool Detection::_internal_has_roll() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Detection::has_roll() const {
+  return _internal_has_roll();
+}
+inline void Detection::clear_roll() {
+  _impl_.roll_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline double Detection::_internal_roll() const {
+  return _impl_.roll_;
+}
+inline double Detection::roll() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.roll)
+  return _internal_roll();
+}
+inline void Detection::_internal_set_roll(double value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.roll_ = value;
+}
+inline void Detection::set_roll(double value) {
+  _internal_set_roll(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.roll)
+}
 
-  // optional double yaw = 4;
-  inline bool has_yaw() const;
-  inline void clear_yaw();
-  static const int kYawFieldNumber = 4;
-  inline double yaw() const;
-  inline void set_yaw(double value);
+// repeated float corners = 11 [packed = true];
+inline int Detection::_internal_corners_size() const {
+  return _impl_.corners_.size();
+}
+inline int Detection::corners_size() const {
+  return _internal_corners_size();
+}
+inline void Detection::clear_corners() {
+  _impl_.corners_.Clear();
+}
+inline float Detection::_internal_corners(int index) const {
+  return _impl_.corners_.Get(index);
+}
+inline float Detection::corners(int index) const {
+  // @@protoc_insertion_point(field_get:proto.Detection.corners)
+  return _internal_corners(index);
+}
+inline void Detection::set_corners(int index, float value) {
+  _impl_.corners_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.Detection.corners)
+}
+inline void Detection::_internal_add_corners(float value) {
+  _impl_.corners_.Add(value);
+}
+inline void Detection::add_corners(float value) {
+  _internal_add_corners(value);
+  // @@protoc_insertion_point(field_add:proto.Detection.corners)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Detection::_internal_corners() const {
+  return _impl_.corners_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Detection::corners() const {
+  // @@protoc_insertion_point(field_list:proto.Detection.corners)
+  return _internal_corners();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Detection::_internal_mutable_corners() {
+  return &_impl_.corners_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Detection::mutable_corners() {
+  // @@protoc_insertion_point(field_mutable_list:proto.Detection.corners)
+  return _internal_mutable_corners();
+}
 
-  // optional double pitch = 5;
-  inline bool has_pitch() const;
-  inline void clear_pitch();
-  static const int kPitchFieldNumber = 5;
-  inline double pitch() const;
-  inline void set_pitch(double value);
+// optional double reprojectionError = 12;
+inline bool Detection::_internal_has_reprojectionerror() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Detection::has_reprojectionerror() const {
+  return _internal_has_reprojectionerror();
+}
+inline void Detection::clear_reprojectionerror() {
+  _impl_.reprojectionerror_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline double Detection::_internal_reprojectionerror() const {
+  return _impl_.reprojectionerror_;
+}
+inline double Detection::reprojectionerror() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.reprojectionError)
+  return _internal_reprojectionerror();
+}
+inline void Detection::_internal_set_reprojectionerror(double value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.reprojectionerror_ = value;
+}
+inline void Detection::set_reprojectionerror(double value) {
+  _internal_set_reprojectionerror(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.reprojectionError)
+}
 
-  // optional double roll = 6;
-  inline bool has_roll() const;
-  inline void clear_roll();
-  static const int kRollFieldNumber = 6;
-  inline double roll() const;
-  inline void set_roll(double value);
+// optional bool predicted = 13;
+inline bool Detection::_internal_has_predicted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Detection::has_predicted() const {
+  return _internal_has_predicted();
+}
+inline void Detection::clear_predicted() {
+  _impl_.predicted_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool Detection::_internal_predicted() const {
+  return _impl_.predicted_;
+}
+inline bool Detection::predicted() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.predicted)
+  return _internal_predicted();
+}
+inline void Detection::_internal_set_predicted(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.predicted_ = value;
+}
+inline void Detection::set_predicted(bool value) {
+  _internal_set_predicted(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.predicted)
+}
 
-  // optional int32 navXTime = 7;
-  inline bool has_navxtime() const;
-  inline void clear_navxtime();
-  static const int kNavXTimeFieldNumber = 7;
-  inline ::google::protobuf::int32 navxtime() const;
-  inline void set_navxtime(::google::protobuf::int32 value);
+// repeated double poseVariance = 14 [packed = true];
+inline int Detection::_internal_posevariance_size() const {
+  return _impl_.posevariance_.size();
+}
+inline int Detection::posevariance_size() const {
+  return _internal_posevariance_size();
+}
+inline void Detection::clear_posevariance() {
+  _impl_.posevariance_.Clear();
+}
+inline double Detection::_internal_posevariance(int index) const {
+  return _impl_.posevariance_.Get(index);
+}
+inline double Detection::posevariance(int index) const {
+  // @@protoc_insertion_point(field_get:proto.Detection.poseVariance)
+  return _internal_posevariance(index);
+}
+inline void Detection::set_posevariance(int index, double value) {
+  _impl_.posevariance_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.Detection.poseVariance)
+}
+inline void Detection::_internal_add_posevariance(double value) {
+  _impl_.posevariance_.Add(value);
+}
+inline void Detection::add_posevariance(double value) {
+  _internal_add_posevariance(value);
+  // @@protoc_insertion_point(field_add:proto.Detection.poseVariance)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Detection::_internal_posevariance() const {
+  return _impl_.posevariance_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Detection::posevariance() const {
+  // @@protoc_insertion_point(field_list:proto.Detection.poseVariance)
+  return _internal_posevariance();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Detection::_internal_mutable_posevariance() {
+  return &_impl_.posevariance_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Detection::mutable_posevariance() {
+  // @@protoc_insertion_point(field_mutable_list:proto.Detection.poseVariance)
+  return _internal_mutable_posevariance();
+}
 
-  // @@protoc_insertion_point(class_scope:proto.CameraPose)
- private:
-  inline void set_has_x();
-  inline void clear_has_x();
-  inline void set_has_y();
-  inline void clear_has_y();
-  inline void set_has_z();
-  inline void clear_has_z();
-  inline void set_has_yaw();
-  inline void clear_has_yaw();
-  inline void set_has_pitch();
-  inline void clear_has_pitch();
-  inline void set_has_roll();
-  inline void clear_has_roll();
-  inline void set_has_navxtime();
-  inline void clear_has_navxtime();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  double x_;
-  double y_;
-  double z_;
-  double yaw_;
-  double pitch_;
-  double roll_;
-  ::google::protobuf::int32 navxtime_;
-  friend void  protobuf_AddDesc_pose_2eproto();
-  friend void protobuf_AssignDesc_pose_2eproto();
-  friend void protobuf_ShutdownFile_pose_2eproto();
-
-  void InitAsDefaultInstance();
-  static CameraPose* default_instance_;
-};
-// ===================================================================
+// repeated double velocity = 15 [packed = true];
+inline int Detection::_internal_velocity_size() const {
+  return _impl_.velocity_.size();
+}
+inline int Detection::velocity_size() const {
+  return _internal_velocity_size();
+}
+inline void Detection::clear_velocity() {
+  _impl_.velocity_.Clear();
+}
+inline double Detection::_internal_velocity(int index) const {
+  return _impl_.velocity_.Get(index);
+}
+inline double Detection::velocity(int index) const {
+  // @@protoc_insertion_point(field_get:proto.Detection.velocity)
+  return _internal_velocity(index);
+}
+inline void Detection::set_velocity(int index, double value) {
+  _impl_.velocity_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.Detection.velocity)
+}
+inline void Detection::_internal_add_velocity(double value) {
+  _impl_.velocity_.Add(value);
+}
+inline void Detection::add_velocity(double value) {
+  _internal_add_velocity(value);
+  // @@protoc_insertion_point(field_add:proto.Detection.velocity)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Detection::_internal_velocity() const {
+  return _impl_.velocity_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Detection::velocity() const {
+  // @@protoc_insertion_point(field_list:proto.Detection.velocity)
+  return _internal_velocity();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Detection::_internal_mutable_velocity() {
+  return &_impl_.velocity_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Detection::mutable_velocity() {
+  // @@protoc_insertion_point(field_mutable_list:proto.Detection.velocity)
+  return _internal_mutable_velocity();
+}
 
+// optional double alternativeReprojectionError = 16;
+inline bool Detection::_internal_has_alternativereprojectionerror() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool Detection::has_alternativereprojectionerror() const {
+  return _internal_has_alternativereprojectionerror();
+}
+inline void Detection::clear_alternativereprojectionerror() {
+  _impl_.alternativereprojectionerror_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline double Detection::_internal_alternativereprojectionerror() const {
+  return _impl_.alternativereprojectionerror_;
+}
+inline double Detection::alternativereprojectionerror() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.alternativeReprojectionError)
+  return _internal_alternativereprojectionerror();
+}
+inline void Detection::_internal_set_alternativereprojectionerror(double value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.alternativereprojectionerror_ = value;
+}
+inline void Detection::set_alternativereprojectionerror(double value) {
+  _internal_set_alternativereprojectionerror(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.alternativeReprojectionError)
+}
 
-// ===================================================================
+// optional double qw = 17;
+inline bool Detection::_internal_has_qw() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool Detection::has_qw() const {
+  return _internal_has_qw();
+}
+inline void Detection::clear_qw() {
+  _impl_.qw_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline double Detection::_internal_qw() const {
+  return _impl_.qw_;
+}
+inline double Detection::qw() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.qw)
+  return _internal_qw();
+}
+inline void Detection::_internal_set_qw(double value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.qw_ = value;
+}
+inline void Detection::set_qw(double value) {
+  _internal_set_qw(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.qw)
+}
 
-// CameraPose
+// optional double qx = 18;
+inline bool Detection::_internal_has_qx() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool Detection::has_qx() const {
+  return _internal_has_qx();
+}
+inline void Detection::clear_qx() {
+  _impl_.qx_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline double Detection::_internal_qx() const {
+  return _impl_.qx_;
+}
+inline double Detection::qx() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.qx)
+  return _internal_qx();
+}
+inline void Detection::_internal_set_qx(double value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.qx_ = value;
+}
+inline void Detection::set_qx(double value) {
+  _internal_set_qx(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.qx)
+}
 
-// optional double x = 1;
-inline bool CameraPose::has_x() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional double qy = 19;
+inline bool Detection::_internal_has_qy() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
 }
-inline void CameraPose::set_has_x() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Detection::has_qy() const {
+  return _internal_has_qy();
 }
-inline void CameraPose::clear_has_x() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void Detection::clear_qy() {
+  _impl_.qy_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
 }
-inline void CameraPose::clear_x() {
-  x_ = 0;
-  clear_has_x();
+inline double Detection::_internal_qy() const {
+  return _impl_.qy_;
 }
-inline double CameraPose::x() const {
-  // @@protoc_insertion_point(field_get:proto.CameraPose.x)
-  return x_;
+inline double Detection::qy() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.qy)
+  return _internal_qy();
 }
-inline void CameraPose::set_x(double value) {
-  set_has_x();
-  x_ = value;
-  // @@protoc_insertion_point(field_set:proto.CameraPose.x)
+inline void Detection::_internal_set_qy(double value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.qy_ = value;
+}
+inline void Detection::set_qy(double value) {
+  _internal_set_qy(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.qy)
 }
 
-// optional double y = 2;
-inline bool CameraPose::has_y() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional double qz = 20;
+inline bool Detection::_internal_has_qz() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
 }
-inline void CameraPose::set_has_y() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool Detection::has_qz() const {
+  return _internal_has_qz();
 }
-inline void CameraPose::clear_has_y() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void Detection::clear_qz() {
+  _impl_.qz_ = 0;
+  _impl_._has_bits_[0] &= ~0x00010000u;
 }
-inline void CameraPose::clear_y() {
-  y_ = 0;
-  clear_has_y();
+inline double Detection::_internal_qz() const {
+  return _impl_.qz_;
 }
-inline double CameraPose::y() const {
-  // @@protoc_insertion_point(field_get:proto.CameraPose.y)
-  return y_;
+inline double Detection::qz() const {
+  // @@protoc_insertion_point(field_get:proto.Detection.qz)
+  return _internal_qz();
 }
-inline void CameraPose::set_y(double value) {
-  set_has_y();
-  y_ = value;
-  // @@protoc_insertion_point(field_set:proto.CameraPose.y)
+inline void Detection::_internal_set_qz(double value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.qz_ = value;
+}
+inline void Detection::set_qz(double value) {
+  _internal_set_qz(value);
+  // @@protoc_insertion_point(field_set:proto.Detection.qz)
 }
 
-// optional double z = 3;
-inline bool CameraPose::has_z() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// -------------------------------------------------------------------
+
+// FrameDetections
+
+// optional uint32 frameIndex = 1;
+inline bool FrameDetections::_internal_has_frameindex() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void CameraPose::set_has_z() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool FrameDetections::has_frameindex() const {
+  return _internal_has_frameindex();
 }
-inline void CameraPose::clear_has_z() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void FrameDetections::clear_frameindex() {
+  _impl_.frameindex_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void CameraPose::clear_z() {
-  z_ = 0;
-  clear_has_z();
+inline uint32_t FrameDetections::_internal_frameindex() const {
+  return _impl_.frameindex_;
 }
-inline double CameraPose::z() const {
-  // @@protoc_insertion_point(field_get:proto.CameraPose.z)
-  return z_;
+inline uint32_t FrameDetections::frameindex() const {
+  // @@protoc_insertion_point(field_get:proto.FrameDetections.frameIndex)
+  return _internal_frameindex();
 }
-inline void CameraPose::set_z(double value) {
-  set_has_z();
-  z_ = value;
-  // @@protoc_insertion_point(field_set:proto.CameraPose.z)
+inline void FrameDetections::_internal_set_frameindex(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.frameindex_ = value;
+}
+inline void FrameDetections::set_frameindex(uint32_t value) {
+  _internal_set_frameindex(value);
+  // @@protoc_insertion_point(field_set:proto.FrameDetections.frameIndex)
 }
 
-// optional double yaw = 4;
-inline bool CameraPose::has_yaw() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// repeated .proto.Detection detections = 2;
+inline int FrameDetections::_internal_detections_size() const {
+  return _impl_.detections_.size();
 }
-inline void CameraPose::set_has_yaw() {
-  _has_bits_[0] |= 0x00000008u;
+inline int FrameDetections::detections_size() const {
+  return _internal_detections_size();
 }
-inline void CameraPose::clear_has_yaw() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void FrameDetections::clear_detections() {
+  _impl_.detections_.Clear();
 }
-inline void CameraPose::clear_yaw() {
-  yaw_ = 0;
-  clear_has_yaw();
+inline ::proto::Detection* FrameDetections::mutable_detections(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.FrameDetections.detections)
+  return _impl_.detections_.Mutable(index);
 }
-inline double CameraPose::yaw() const {
-  // @@protoc_insertion_point(field_get:proto.CameraPose.yaw)
-  return yaw_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Detection >*
+FrameDetections::mutable_detections() {
+  // @@protoc_insertion_point(field_mutable_list:proto.FrameDetections.detections)
+  return &_impl_.detections_;
 }
-inline void CameraPose::set_yaw(double value) {
-  set_has_yaw();
-  yaw_ = value;
-  // @@protoc_insertion_point(field_set:proto.CameraPose.yaw)
+inline const ::proto::Detection& FrameDetections::_internal_detections(int index) const {
+  return _impl_.detections_.Get(index);
+}
+inline const ::proto::Detection& FrameDetections::detections(int index) const {
+  // @@protoc_insertion_point(field_get:proto.FrameDetections.detections)
+  return _internal_detections(index);
+}
+inline ::proto::Detection* FrameDetections::_internal_add_detections() {
+  return _impl_.detections_.Add();
+}
+inline ::proto::Detection* FrameDetections::add_detections() {
+  ::proto::Detection* _add = _internal_add_detections();
+  // @@protoc_insertion_point(field_add:proto.FrameDetections.detections)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Detection >&
+FrameDetections::detections() const {
+  // @@protoc_insertion_point(field_list:proto.FrameDetections.detections)
+  return _impl_.detections_;
 }
 
-// optional double pitch = 5;
-inline bool CameraPose::has_pitch() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// optional uint64 sequence = 3;
+inline bool FrameDetections::_internal_has_sequence() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void CameraPose::set_has_pitch() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool FrameDetections::has_sequence() const {
+  return _internal_has_sequence();
 }
-inline void CameraPose::clear_has_pitch() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void FrameDetections::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void CameraPose::clear_pitch() {
-  pitch_ = 0;
-  clear_has_pitch();
+inline uint64_t FrameDetections::_internal_sequence() const {
+  return _impl_.sequence_;
 }
-inline double CameraPose::pitch() const {
-  // @@protoc_insertion_point(field_get:proto.CameraPose.pitch)
-  return pitch_;
+inline uint64_t FrameDetections::sequence() const {
+  // @@protoc_insertion_point(field_get:proto.FrameDetections.sequence)
+  return _internal_sequence();
 }
-inline void CameraPose::set_pitch(double value) {
-  set_has_pitch();
-  pitch_ = value;
-  // @@protoc_insertion_point(field_set:proto.CameraPose.pitch)
+inline void FrameDetections::_internal_set_sequence(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sequence_ = value;
+}
+inline void FrameDetections::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:proto.FrameDetections.sequence)
 }
 
-// optional double roll = 6;
-inline bool CameraPose::has_roll() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+// optional uint64 captureMonotonicUs = 4;
+inline bool FrameDetections::_internal_has_capturemonotonicus() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void CameraPose::set_has_roll() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool FrameDetections::has_capturemonotonicus() const {
+  return _internal_has_capturemonotonicus();
 }
-inline void CameraPose::clear_has_roll() {
-  _has_bits_[0] &= ~0x00000020u;
+inline void FrameDetections::clear_capturemonotonicus() {
+  _impl_.capturemonotonicus_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void CameraPose::clear_roll() {
-  roll_ = 0;
-  clear_has_roll();
+inline uint64_t FrameDetections::_internal_capturemonotonicus() const {
+  return _impl_.capturemonotonicus_;
 }
-inline double CameraPose::roll() const {
-  // @@protoc_insertion_point(field_get:proto.CameraPose.roll)
-  return roll_;
+inline uint64_t FrameDetections::capturemonotonicus() const {
+  // @@protoc_insertion_point(field_get:proto.FrameDetections.captureMonotonicUs)
+  return _internal_capturemonotonicus();
 }
-inline void CameraPose::set_roll(double value) {
-  set_has_roll();
-  roll_ = value;
-  // @@protoc_insertion_point(field_set:proto.CameraPose.roll)
+inline void FrameDetections::_internal_set_capturemonotonicus(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.capturemonotonicus_ = value;
+}
+inline void FrameDetections::set_capturemonotonicus(uint64_t value) {
+  _internal_set_capturemonotonicus(value);
+  // @@protoc_insertion_point(field_set:proto.FrameDetections.captureMonotonicUs)
 }
 
-// optional int32 navXTime = 7;
-inline bool CameraPose::has_navxtime() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+// optional uint64 captureWallUs = 5;
+inline bool FrameDetections::_internal_has_capturewallus() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void CameraPose::set_has_navxtime() {
-  _has_bits_[0] |= 0x00000040u;
+inline bool FrameDetections::has_capturewallus() const {
+  return _internal_has_capturewallus();
 }
-inline void CameraPose::clear_has_navxtime() {
-  _has_bits_[0] &= ~0x00000040u;
+inline void FrameDetections::clear_capturewallus() {
+  _impl_.capturewallus_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void CameraPose::clear_navxtime() {
-  navxtime_ = 0;
-  clear_has_navxtime();
+inline uint64_t FrameDetections::_internal_capturewallus() const {
+  return _impl_.capturewallus_;
 }
-inline ::google::protobuf::int32 CameraPose::navxtime() const {
-  // @@protoc_insertion_point(field_get:proto.CameraPose.navXTime)
-  return navxtime_;
+inline uint64_t FrameDetections::capturewallus() const {
+  // @@protoc_insertion_point(field_get:proto.FrameDetections.captureWallUs)
+  return _internal_capturewallus();
 }
-inline void CameraPose::set_navxtime(::google::protobuf::int32 value) {
-  set_has_navxtime();
-  navxtime_ = value;
-  // @@protoc_insertion_point(field_set:proto.CameraPose.navXTime)
+inline void FrameDetections::_internal_set_capturewallus(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.capturewallus_ = value;
+}
+inline void FrameDetections::set_capturewallus(uint64_t value) {
+  _internal_set_capturewallus(value);
+  // @@protoc_insertion_point(field_set:proto.FrameDetections.captureWallUs)
 }
 
+// optional uint32 cameraId = 6;
+inline bool FrameDetections::_internal_has_cameraid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool FrameDetections::has_cameraid() const {
+  return _internal_has_cameraid();
+}
+inline void FrameDetections::clear_cameraid() {
+  _impl_.cameraid_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t FrameDetections::_internal_cameraid() const {
+  return _impl_.cameraid_;
+}
+inline uint32_t FrameDetections::cameraid() const {
+  // @@protoc_insertion_point(field_get:proto.FrameDetections.cameraId)
+  return _internal_cameraid();
+}
+inline void FrameDetections::_internal_set_cameraid(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.cameraid_ = value;
+}
+inline void FrameDetections::set_cameraid(uint32_t value) {
+  _internal_set_cameraid(value);
+  // @@protoc_insertion_point(field_set:proto.FrameDetections.cameraId)
+}
 
-// @@protoc_insertion_point(namespace_scope)
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
 
-}  // namespace proto
+// -------------------------------------------------------------------
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
 
+// @@protoc_insertion_point(namespace_scope)
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+}  // namespace proto
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_pose_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_pose_2eproto
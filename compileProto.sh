@@ -1,2 +1,7 @@
 #!/usr/bin/env bash
-protoc -I=proto --cpp_out=aruco_test/gen proto/*.proto
\ No newline at end of file
+# the checked in sources are generated by protoc 3.21, regenerating with another version changes the runtime they need
+if ! protoc --version | grep -q " 3\.21\."; then
+    echo "protoc 3.21 needed, found $(protoc --version), see installProtobuf.sh"
+    exit 1
+fi
+protoc -I=proto --cpp_out=aruco_test/gen proto/*.proto
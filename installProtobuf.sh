@@ -0,0 +1,21 @@
+#!/usr/bin/env bash
+# The generated aruco_test/gen/pose.pb.* need this protobuf and its protoc, CMakeLists.txt checks the version
+if [[ $(/usr/bin/id -u) -ne 0 ]]; then
+    echo "Not run as root, exiting."
+    exit
+fi
+mkdir installProtobuf
+cd installProtobuf
+apt update
+apt install -y build-essential cmake wget
+wget https://github.com/protocolbuffers/protobuf/releases/download/v21.12/protobuf-cpp-3.21.12.tar.gz
+tar xzf protobuf-cpp-3.21.12.tar.gz
+cd protobuf-3.21.12
+mkdir build
+cd build
+cmake -D CMAKE_BUILD_TYPE=RELEASE -D CMAKE_INSTALL_PREFIX=/usr/local -D protobuf_BUILD_TESTS=OFF -D protobuf_BUILD_SHARED_LIBS=OFF ..
+make -j$(nproc)
+make install
+ldconfig
+cd ../../..
+rm -rf installProtobuf
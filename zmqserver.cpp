@@ -1,9 +1,13 @@
 #include <iostream>
+#include <map>
 #include <zmq.hpp>
 #include <string>
+#include <cstdlib>
+#include <cstring>
 #include <google/protobuf/stubs/common.h>
-#include <opencv/cv.hpp>
 #include "gen/pose.pb.h"
+#include "common/capture_stamp.h"
+#include "common/latency_stats.h"
 
 const std::string currentDateTime() {
     time_t     now = time(0);
@@ -17,42 +21,165 @@ const std::string currentDateTime() {
     return buf;
 }
 
+/**
+ * A sequence number this far below the last one is a restarted detector, not a reordered frame
+ */
+const uint64_t restartJump = 1000;
+
+/**
+ * Capture to receive latency and sequence gaps of the frames received since the last report
+ */
+struct receive_stats {
+    latency_histogram latency;
+    uint64_t frames = 0;
+    uint64_t detections = 0;
+    std::map<uint32_t, uint64_t> lastSequences; // per camera, each one counts its own frames
+    uint64_t missing = 0;       // sequence numbers skipped, frames dropped on the way
+    uint64_t outOfOrder = 0;    // sequence numbers at or below the last one, repeated or reordered frames
+    uint64_t restarts = 0;      // cameras whose sequence started over, the detector was restarted
+    uint64_t totalFrames = 0, totalMissing = 0;
+
+    void add(const proto::FrameDetections &frame, uint64_t latencyUs) {
+        frames++;
+        totalFrames++;
+        detections += frame.detections_size();
+        latency.record(latencyUs);
+
+        uint64_t sequence = frame.sequence();
+        std::map<uint32_t, uint64_t>::iterator last = lastSequences.find(frame.cameraid());
+        if(last == lastSequences.end()) {
+            lastSequences[frame.cameraid()] = sequence;
+            return;
+        }
+        uint64_t &lastSequence = last->second;
+        if(sequence <= lastSequence && (sequence == 1 || lastSequence - sequence >= restartJump)) {
+            // the detector counts from 1 again, start over instead of calling every frame out of order
+            restarts++;
+            lastSequence = sequence;
+        } else if(sequence <= lastSequence) {
+            outOfOrder++;
+        } else {
+            missing += sequence - lastSequence - 1;
+            totalMissing += sequence - lastSequence - 1;
+            lastSequence = sequence;
+        }
+    }
 
-int main() {
+    void report() {
+        uint64_t counts[latency_histogram::bucketCount];
+        uint64_t maxMicros, sumMicros;
+        latency.take(counts, maxMicros, sumMicros);
+        latency_summary summary = latency_histogram::summarize(counts, maxMicros, sumMicros);
+
+        std::cout << "[" << currentDateTime() << "] " << frames << " frames, " << detections << " detections, "
+                  << "latency us p50 " << summary.p50 << " p90 " << summary.p90 << " p99 " << summary.p99
+                  << " max " << summary.max << ", " << missing << " missing, " << outOfOrder << " out of order, "
+                  << restarts << " restarts (total " << totalFrames << " frames, " << totalMissing << " missing, "
+                  << lastSequences.size() << " cameras)" << std::endl;
+
+        frames = 0;
+        detections = 0;
+        missing = 0;
+        outOfOrder = 0;
+        restarts = 0;
+    }
+};
+
+/**
+ * zmqserver [endpoint] [-wall] [-sub] [-conflate] [-hwm n]
+ *
+ * Receives the FrameDetections of a detector and reports once a second how old the frames were on
+ * arrival. The monotonic capture time is used by default and is only valid with the detector on this
+ * machine, -wall uses the wall clock time instead, for a detector on a clock synchronized machine. The
+ * reports go on while no frames arrive, so a stalled detector shows up as periods without frames.
+ *
+ * By default it binds a PAIR socket for a detector on the pair transport. -sub connects a subscriber to
+ * a detector publishing with pub or xpub instead, -conflate keeps only the newest frame waiting, the way
+ * a controller that must not act on a stale pose would read, and -hwm sets the receive high water mark.
+ */
+int main(int argc, char **argv) {
 
     GOOGLE_PROTOBUF_VERIFY_VERSION;
 
+    std::string endpoint;
+    bool wallClock = false;
+    bool subscribe = false;
+    bool conflate = false;
+    int highWaterMark = 0;
+    for(int i = 1; i < argc; i++) {
+        if(std::strcmp(argv[i], "-wall") == 0)
+            wallClock = true;
+        else if(std::strcmp(argv[i], "-sub") == 0)
+            subscribe = true;
+        else if(std::strcmp(argv[i], "-conflate") == 0)
+            conflate = true;
+        else if(std::strcmp(argv[i], "-hwm") == 0 && i + 1 < argc)
+            highWaterMark = std::atoi(argv[++i]);
+        else
+            endpoint = argv[i];
+    }
+    if(endpoint.empty())
+        endpoint = subscribe ? "tcp://127.0.0.1:5000" : "tcp://*:5000";
+    if(conflate && !subscribe) {
+        std::cerr << "-conflate needs -sub" << std::endl;
+        return 1;
+    }
 
     //set up zmq
 
     zmq::context_t context(1);
 
 
-    zmq::socket_t socket(context, ZMQ_PAIR);
+    zmq::socket_t socket(context, subscribe ? ZMQ_SUB : ZMQ_PAIR);
 
-    socket.bind("tcp://*:5000");
+    // options have to be set before the socket is attached
+    if(highWaterMark > 0)
+        socket.setsockopt(ZMQ_RCVHWM, &highWaterMark, sizeof(highWaterMark));
+    if(conflate) {
+        int on = 1;
+        socket.setsockopt(ZMQ_CONFLATE, &on, sizeof(on));
+    }
+    // recv gives up after a report period, so a stalled or dead detector still gets its reports
+    int receiveTimeoutMs = 1000;
+    socket.setsockopt(ZMQ_RCVTIMEO, &receiveTimeoutMs, sizeof(receiveTimeoutMs));
+
+    if(subscribe) {
+        socket.setsockopt(ZMQ_SUBSCRIBE, "", 0);
+        socket.connect(endpoint);
+    } else {
+        socket.bind(endpoint);
+    }
 
-    proto::CameraPose pose;
+    proto::FrameDetections frame;
+    receive_stats stats;
+    uint64_t lastReport = monotonicMicros();
 
     std::cout << "Starting loop" << std::endl;
     while(true){
 
-        std::cout<<"trying to recieve" << std::endl;
+        // also after a receive that timed out, a period without frames is reported as one
+        if(monotonicMicros() - lastReport >= 1000000) {
+            stats.report();
+            lastReport = monotonicMicros();
+        }
 
         zmq::message_t recieved;
-        socket.recv(&recieved);
-
-
-
-        std::cout << "[" << currentDateTime() <<"] recieved " <<
-                  std::string(static_cast<char*>(recieved.data()), recieved.size()) << std::endl;
-
-        char key = (char) cv::waitKey(10);
-        if (key == 27) break;
+        if(!socket.recv(&recieved))
+            continue;
+        uint64_t receivedUs = wallClock ? wallMicros() : monotonicMicros();
+
+        if(!frame.ParseFromArray(recieved.data(), (int)recieved.size())) {
+            std::cout << "[" << currentDateTime() << "] could not parse " << recieved.size() << " bytes" << std::endl;
+            continue;
+        }
+
+        uint64_t capturedUs = wallClock ? frame.capturewallus() : frame.capturemonotonicus();
+        // a clock that is behind the detector's would underflow
+        stats.add(frame, receivedUs > capturedUs ? receivedUs - capturedUs : 0);
     }
 
     google::protobuf::ShutdownProtobufLibrary();
 
     return 0;
 
-}
\ No newline at end of file
+}